@@ -0,0 +1,184 @@
+#include "adc_calib.h"
+#include "adc_sensor.h"
+
+// Tabel offset aktif per channel (reference - measured) di grid seragam
+typedef struct {
+    float offset_c[ADC_CALIB_GRID_POINTS];
+    q16_t offset_q16[ADC_CALIB_GRID_POINTS];
+} adc_calib_table_t;
+
+static adc_calib_table_t adc_calib_tables[ADC_CALIB_CHANNELS];
+
+// Jarak minimum antar titik; lebih dekat dianggap titik yang sama (diganti)
+#define ADC_CALIB_MERGE_C       2.0f
+
+// --- Profil ---
+void adc_calib_profile_init(adc_calib_profile_t *profile) {
+    profile->magic = ADC_CALIB_PROFILE_MAGIC;
+    profile->count = 0;
+    profile->tune_ku = 0.0f;
+    profile->tune_tu_s = 0.0f;
+}
+
+uint8_t adc_calib_profile_add_point(adc_calib_profile_t *profile, float measured_c, float reference_c) {
+    if (measured_c < 0.0f || measured_c > (float)((ADC_CALIB_GRID_POINTS - 1) * ADC_CALIB_GRID_STEP_C)) {
+        return 0;
+    }
+
+    // Ganti titik yang hampir sama
+    for (uint8_t i = 0; i < profile->count; i++) {
+        float d = profile->points[i].measured_c - measured_c;
+        if (d < ADC_CALIB_MERGE_C && d > -ADC_CALIB_MERGE_C) {
+            profile->points[i].measured_c = measured_c;
+            profile->points[i].reference_c = reference_c;
+            return 1;
+        }
+    }
+    if (profile->count >= ADC_CALIB_MAX_POINTS) return 0;
+
+    // Sisipkan terurut naik menurut measured_c
+    uint8_t i = profile->count;
+    while (i > 0 && profile->points[i - 1].measured_c > measured_c) {
+        profile->points[i] = profile->points[i - 1];
+        i--;
+    }
+    profile->points[i].measured_c = measured_c;
+    profile->points[i].reference_c = reference_c;
+    profile->count++;
+    return 1;
+}
+
+// --- Tabel ---
+static void adc_calib_identity(adc_calib_table_t *table) {
+    for (uint8_t i = 0; i < ADC_CALIB_GRID_POINTS; i++) {
+        table->offset_c[i] = 0.0f;
+        table->offset_q16[i] = 0;
+    }
+}
+
+// Profil valid: magic benar, measured dan reference sama-sama naik tegas
+static uint8_t adc_calib_profile_valid(const adc_calib_profile_t *profile) {
+    if (profile->magic != ADC_CALIB_PROFILE_MAGIC || profile->count > ADC_CALIB_MAX_POINTS) return 0;
+    for (uint8_t i = 1; i < profile->count; i++) {
+        if (profile->points[i].measured_c <= profile->points[i - 1].measured_c) return 0;
+        if (profile->points[i].reference_c <= profile->points[i - 1].reference_c) return 0;
+    }
+    return 1;
+}
+
+// Offset di suhu terukur t: linear antar titik, konstan di luar titik ujung
+static float adc_calib_offset_at(const adc_calib_profile_t *profile, float t) {
+    const adc_calib_point_t *p = profile->points;
+    uint8_t n = profile->count;
+
+    if (t <= p[0].measured_c) return p[0].reference_c - p[0].measured_c;
+    if (t >= p[n - 1].measured_c) return p[n - 1].reference_c - p[n - 1].measured_c;
+
+    uint8_t i = 1;
+    while (p[i].measured_c < t) i++;
+    float off0 = p[i - 1].reference_c - p[i - 1].measured_c;
+    float off1 = p[i].reference_c - p[i].measured_c;
+    float frac = (t - p[i - 1].measured_c) / (p[i].measured_c - p[i - 1].measured_c);
+    return off0 + (off1 - off0) * frac;
+}
+
+uint8_t adc_calib_load(uint8_t channel, const adc_calib_profile_t *profile) {
+    if (channel >= ADC_CALIB_CHANNELS) return 0;
+
+    // Dibangun di buffer lokal lalu disalin, agar pembaca tidak melihat tabel setengah jadi
+    adc_calib_table_t table;
+    uint8_t ok = 1;
+    if (profile == NULL || profile->count == 0) {
+        adc_calib_identity(&table);
+    } else if (!adc_calib_profile_valid(profile)) {
+        adc_calib_identity(&table);
+        ok = 0;
+    } else {
+        for (uint8_t i = 0; i < ADC_CALIB_GRID_POINTS; i++) {
+            float off = adc_calib_offset_at(profile, (float)(i * ADC_CALIB_GRID_STEP_C));
+            table.offset_c[i] = off;
+            table.offset_q16[i] = q16_from_float(off);
+        }
+    }
+
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    adc_calib_tables[channel] = table;
+    __set_PRIMASK(primask);
+    return ok;
+}
+
+float adc_calib_apply(uint8_t channel, float measured_c) {
+    if (channel >= ADC_CALIB_CHANNELS) return measured_c;
+    const float *off = adc_calib_tables[channel].offset_c;
+
+    float x = measured_c * (1.0f / ADC_CALIB_GRID_STEP_C);
+    if (x <= 0.0f) return measured_c + off[0];
+    if (x >= (float)(ADC_CALIB_GRID_POINTS - 1)) return measured_c + off[ADC_CALIB_GRID_POINTS - 1];
+    int32_t i = (int32_t)x;
+    return measured_c + off[i] + (off[i + 1] - off[i]) * (x - (float)i);
+}
+
+q16_t adc_calib_apply_q16(uint8_t channel, q16_t measured_c) {
+    if (channel >= ADC_CALIB_CHANNELS) return measured_c;
+    const q16_t *off = adc_calib_tables[channel].offset_q16;
+
+    // Indeks grid Q16 = suhu / 16 (geser)
+    q16_t pos = q16_clamp(measured_c >> ADC_CALIB_GRID_SHIFT, 0,
+                          q16_from_int(ADC_CALIB_GRID_POINTS - 1));
+    return measured_c + q16_lut_interp(off, ADC_CALIB_GRID_POINTS, pos);
+}
+
+// --- Capture ---
+void adc_calib_capture_start(adc_calib_capture_t *capture, uint8_t channel) {
+    capture->channel = channel;
+    capture->samples = 0;
+    capture->last_seq = adc_sensor_sequence();
+    capture->stable = 0;
+}
+
+// Suhu tanpa koreksi dari snapshot blok ADC (sama dengan adc_sensor_get_data)
+static float adc_calib_uncorrected(uint8_t channel, const uint32_t *sums) {
+    float ambient = adc_calc_ambient_temp(adc_sum_to_voltage(sums[ADC_CH_NTC]));
+    uint8_t ch = (channel == ADC_CALIB_T12) ? ADC_CH_T12 : ADC_CH_HOT_AIR;
+    float v_tc = adc_compensate_op07_bias(adc_sum_to_voltage(sums[ch]));
+    return adc_calc_thermocouple_temp(v_tc, ambient);
+}
+
+adc_calib_capture_state_t adc_calib_capture_poll(adc_calib_capture_t *capture) {
+    uint32_t sums[ADC_BUFFER_SIZE];
+    uint32_t seq = adc_sensor_get_sums(sums);
+    if (seq == 0 || seq == capture->last_seq) {
+        return capture->stable ? ADC_CALIB_CAPTURE_STABLE : ADC_CALIB_CAPTURE_BUSY;
+    }
+    capture->last_seq = seq;
+
+    float t = adc_calib_uncorrected(capture->channel, sums);
+    if (capture->samples == 0) {
+        capture->sum = 0.0f;
+        capture->min = t;
+        capture->max = t;
+    }
+    capture->sum += t;
+    if (t < capture->min) capture->min = t;
+    if (t > capture->max) capture->max = t;
+
+    if (++capture->samples < ADC_CALIB_CAPTURE_BLOCKS) {
+        return capture->stable ? ADC_CALIB_CAPTURE_STABLE : ADC_CALIB_CAPTURE_BUSY;
+    }
+
+    // Jendela penuh: terima jika stabil, lalu mulai jendela berikutnya
+    uint8_t stable = (capture->max - capture->min) <= ADC_CALIB_STABLE_BAND_C;
+    if (stable) {
+        capture->measured_c = capture->sum / (float)capture->samples;
+    }
+    capture->stable = stable;
+    capture->samples = 0;
+    return stable ? ADC_CALIB_CAPTURE_STABLE : ADC_CALIB_CAPTURE_UNSTABLE;
+}
+
+uint8_t adc_calib_capture_commit(const adc_calib_capture_t *capture, adc_calib_profile_t *profile,
+                                 float reference_c) {
+    if (!capture->stable) return 0;
+    return adc_calib_profile_add_point(profile, capture->measured_c, reference_c);
+}
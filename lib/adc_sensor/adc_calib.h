@@ -0,0 +1,92 @@
+#ifndef ADC_CALIB_H
+#define ADC_CALIB_H
+
+#include <stdint.h>
+#include "qmath.h"
+
+// Kalibrasi multi-titik per tip: setiap titik = suhu terukur (rantai konversi tanpa
+// koreksi: gain OP07, bias, tabel tipe K) vs suhu termometer referensi. Saat profil
+// dimuat, titik-titik diubah menjadi tabel koreksi (offset) seragam yang diterapkan
+// di jalur konversi dengan perkalian konstanta saja (tanpa pembagian per sampel).
+// Error gain/bias per board ikut terkoreksi, jadi THERMOCOUPLE_GAIN cukup nominal.
+
+#define ADC_CALIB_T12           0
+#define ADC_CALIB_HOT_AIR       1
+#define ADC_CALIB_CHANNELS      2
+
+#ifndef ADC_CALIB_MAX_POINTS
+#define ADC_CALIB_MAX_POINTS    8
+#endif
+
+// Grid tabel koreksi: 0..640 C langkah 16 C (pangkat dua: indeks Q16 = geser 4 bit)
+// Titik kalibrasi yang tidak jatuh di grid bisa meleset ~0.3 C jika kemiringan offset
+// berubah tajam di titik itu
+#define ADC_CALIB_GRID_SHIFT    4
+#define ADC_CALIB_GRID_STEP_C   (1 << ADC_CALIB_GRID_SHIFT)
+#define ADC_CALIB_GRID_POINTS   41
+
+#define ADC_CALIB_PROFILE_MAGIC 0xCA1C     // Naik jika format profil berubah
+
+// Capture titik: sampel per blok ADC, titik diterima jika rentang (maks - min)
+// selama satu jendela <= pita stabil
+#ifndef ADC_CALIB_CAPTURE_BLOCKS
+#define ADC_CALIB_CAPTURE_BLOCKS    200     // 1 s pada blok 5 ms
+#endif
+#ifndef ADC_CALIB_STABLE_BAND_C
+#define ADC_CALIB_STABLE_BAND_C     1.0f
+#endif
+
+typedef struct {
+    float measured_c;           // Suhu hasil konversi tanpa koreksi
+    float reference_c;          // Suhu termometer referensi
+} adc_calib_point_t;
+
+// Profil tip (format penyimpanan): titik diurutkan naik menurut measured_c
+typedef struct {
+    uint16_t magic;             // ADC_CALIB_PROFILE_MAGIC jika berisi
+    uint8_t count;
+    adc_calib_point_t points[ADC_CALIB_MAX_POINTS];
+
+    // Hasil autotune relay untuk tip/nozzle ini (fuzzy_autotune_apply); 0 = belum ada
+    float tune_ku;              // % daya per C
+    float tune_tu_s;
+} adc_calib_profile_t;
+
+typedef enum {
+    ADC_CALIB_CAPTURE_BUSY,     // Jendela belum penuh
+    ADC_CALIB_CAPTURE_STABLE,   // Rata-rata jendela siap di-commit
+    ADC_CALIB_CAPTURE_UNSTABLE  // Suhu masih bergerak, jendela diulang
+} adc_calib_capture_state_t;
+
+typedef struct {
+    uint8_t channel;
+    uint16_t samples;
+    uint32_t last_seq;
+    float sum;
+    float min;
+    float max;
+    float measured_c;           // Hasil jendela stabil terakhir
+    uint8_t stable;
+} adc_calib_capture_t;
+
+// --- Profil ---
+void adc_calib_profile_init(adc_calib_profile_t *profile);
+// Tambah/ganti titik (titik dengan measured_c dalam 2 C diganti); 0 jika penuh/tidak valid
+uint8_t adc_calib_profile_add_point(adc_calib_profile_t *profile, float measured_c, float reference_c);
+
+// --- Tabel aktif per channel ---
+// Bangun tabel koreksi dari profil (NULL/kosong = tanpa koreksi). Mengembalikan 0 jika
+// profil ditolak (magic salah, titik tidak monoton); channel kembali tanpa koreksi.
+uint8_t adc_calib_load(uint8_t channel, const adc_calib_profile_t *profile);
+float adc_calib_apply(uint8_t channel, float measured_c);
+q16_t adc_calib_apply_q16(uint8_t channel, q16_t measured_c);
+
+// --- Capture terhadap termometer referensi ---
+// Panggil adc_calib_capture_poll berkala setelah tip mencapai setpoint; saat STABLE,
+// baca termometer referensi lalu adc_calib_capture_commit, kemudian adc_calib_load.
+void adc_calib_capture_start(adc_calib_capture_t *capture, uint8_t channel);
+adc_calib_capture_state_t adc_calib_capture_poll(adc_calib_capture_t *capture);
+uint8_t adc_calib_capture_commit(const adc_calib_capture_t *capture, adc_calib_profile_t *profile,
+                                 float reference_c);
+
+#endif
@@ -0,0 +1,90 @@
+// Konversi ADC -> tegangan/suhu lewat tabel adc_lut.h (jalur float dan Q16.16).
+// Terpisah dari adc_sensor.c (DMA/ISR) agar bisa diuji di host: test/test_adc_lut.
+#include "adc_sensor.h"
+#include "adc_lut.h"
+
+_Static_assert(NTC_R0 == ADC_LUT_NTC_R0 && NTC_BETA == ADC_LUT_NTC_BETA &&
+               NTC_R_SERIES == ADC_LUT_NTC_R_SERIES,
+               "adc_lut.h usang: jalankan lib/adc_sensor/tools/gen_adc_lut.py");
+
+// Interpolasi linear pada tabel seragam; x = posisi pecahan, di luar tabel diekstrapolasi
+static float lut_interp(const float *table, uint16_t points, float x) {
+    int32_t i = (int32_t)x;
+    if (x < 0.0f) i = 0;
+    if (i > points - 2) i = points - 2;
+    float y0 = table[i];
+    return y0 + (table[i + 1] - y0) * (x - (float)i);
+}
+
+// Invers tabel T(emf); dipakai saat init (ambang watchdog), tidak di ISR
+uint16_t adc_tc_temp_to_code(float t_c, float ambient_temp) {
+    float uv = (ADC_LUT_TC_POINTS - 1) * ADC_LUT_TC_EMF_STEP_UV;
+    for (uint16_t i = 1; i < ADC_LUT_TC_POINTS; i++) {
+        if (adc_lut_tc_temp_c[i] >= t_c) {
+            float t0 = adc_lut_tc_temp_c[i - 1];
+            float frac = (t_c - t0) / (adc_lut_tc_temp_c[i] - t0);
+            uv = ((float)(i - 1) + frac) * ADC_LUT_TC_EMF_STEP_UV;
+            break;
+        }
+    }
+    uv -= lut_interp(adc_lut_tc_emf_uv, ADC_LUT_CJ_POINTS,
+                     (ambient_temp - ADC_LUT_CJ_T_MIN) * (1.0f / ADC_LUT_CJ_T_STEP));
+    float volts = uv * 1e-6f * THERMOCOUPLE_GAIN + OP07_BIAS_VOLTAGE;
+    float code = volts * ADC_MAX_VALUE / ADC_VREF;
+    if (code < 1.0f) code = 1.0f;
+    if (code > ADC_MAX_VALUE) code = ADC_MAX_VALUE;
+    return (uint16_t)code;
+}
+
+float adc_raw_to_voltage(uint16_t raw) {
+    return (raw * ADC_VREF) / ADC_MAX_VALUE;
+}
+
+// Resolusi penuh jumlah oversampling (bit efektif tambahan tidak dibulatkan)
+float adc_sum_to_voltage(uint32_t sum) {
+    return ((float)sum * ADC_VREF) / (ADC_MAX_VALUE * ADC_OVERSAMPLE);
+}
+
+float adc_compensate_op07_bias(float adc_voltage) {
+    return (adc_voltage - OP07_BIAS_VOLTAGE) / THERMOCOUPLE_GAIN;
+}
+
+float adc_calc_ambient_temp(float ntc_voltage) {
+    // Rel ADC = NTC terbuka/hubung singkat
+    if (ntc_voltage <= 0.05f || ntc_voltage >= (ADC_VREF - 0.05f)) return 25.0f;
+    float x = ntc_voltage * (ADC_LUT_NTC_SEGMENTS / ADC_VREF);
+    return lut_interp(adc_lut_ntc_temp_c, ADC_LUT_NTC_SEGMENTS + 1, x);
+}
+
+float adc_calc_thermocouple_temp(float tc_voltage, float ambient_temp) {
+    // Cold junction: tambahkan emf tipe K pada suhu ambient, lalu balik ke suhu
+    float cj_uv = lut_interp(adc_lut_tc_emf_uv, ADC_LUT_CJ_POINTS,
+                             (ambient_temp - ADC_LUT_CJ_T_MIN) * (1.0f / ADC_LUT_CJ_T_STEP));
+    float emf_uv = tc_voltage * 1e6f + cj_uv;
+    return lut_interp(adc_lut_tc_temp_c, ADC_LUT_TC_POINTS, emf_uv * (1.0f / ADC_LUT_TC_EMF_STEP_UV));
+}
+
+// --- Jalur fixed-point ---
+// Skala jumlah oversampling -> posisi tabel (Q32), konstanta saat kompilasi
+#define ADC_SUM_FULL_SCALE      (ADC_MAX_VALUE * ADC_OVERSAMPLE)
+#define ADC_NTC_POS_SCALE       ((uint32_t)(ADC_LUT_NTC_SEGMENTS * 4294967296.0 / ADC_SUM_FULL_SCALE))
+#define ADC_TC_POS_SCALE        ((uint32_t)(ADC_VREF * 1e6 * 4294967296.0 / \
+                                 (ADC_SUM_FULL_SCALE * THERMOCOUPLE_GAIN * ADC_LUT_TC_EMF_STEP_UV)))
+#define ADC_NTC_RAIL_SUM        ((uint32_t)(0.05f / ADC_VREF * ADC_SUM_FULL_SCALE))
+#define ADC_OP07_BIAS_SUM       ((int32_t)(OP07_BIAS_VOLTAGE / ADC_VREF * ADC_SUM_FULL_SCALE))
+
+q16_t adc_sum_to_ambient_q16(uint32_t ntc_sum) {
+    if (ntc_sum <= ADC_NTC_RAIL_SUM || ntc_sum >= (uint32_t)ADC_SUM_FULL_SCALE - ADC_NTC_RAIL_SUM) {
+        return Q16(25.0f);
+    }
+    q16_t pos = (q16_t)(((uint64_t)ntc_sum * ADC_NTC_POS_SCALE) >> 16);
+    return q16_lut_interp(adc_lut_ntc_temp_q16, ADC_LUT_NTC_SEGMENTS + 1, pos);
+}
+
+q16_t adc_sum_to_tc_temp_q16(uint32_t tc_sum, q16_t ambient) {
+    q16_t cj_pos = (ambient - Q16(ADC_LUT_CJ_T_MIN)) / (int32_t)ADC_LUT_CJ_T_STEP;
+    q16_t cj = q16_lut_interp(adc_lut_tc_cj_pos_q16, ADC_LUT_CJ_POINTS, cj_pos);
+    int32_t sum = (int32_t)tc_sum - ADC_OP07_BIAS_SUM;
+    q16_t pos = (q16_t)(((int64_t)sum * ADC_TC_POS_SCALE) >> 16) + cj;
+    return q16_lut_interp(adc_lut_tc_temp_q16, ADC_LUT_TC_POINTS, pos);
+}
\ No newline at end of file
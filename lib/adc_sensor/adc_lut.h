@@ -0,0 +1,87 @@
+#ifndef ADC_LUT_H
+#define ADC_LUT_H
+
+// DIBUAT OTOMATIS oleh tools/gen_adc_lut.py - jangan diedit manual.
+// NTC_R0=10000 NTC_BETA=3950 NTC_R_SERIES=10000
+
+#include <stdint.h>
+
+#define ADC_LUT_NTC_R0          10000.0f
+#define ADC_LUT_NTC_BETA        3950.0f
+#define ADC_LUT_NTC_R_SERIES    10000.0f
+
+// Suhu NTC (C) per rasio tegangan v/VREF, 64 segmen seragam
+#define ADC_LUT_NTC_SEGMENTS    64
+static const float adc_lut_ntc_temp_c[65] = {
+    150.000f, 150.000f, 129.321f, 112.739f, 101.602f, 93.260f,
+    86.605f, 81.071f, 76.332f, 72.182f, 68.487f, 65.152f,
+    62.106f, 59.300f, 56.693f, 54.254f, 51.959f, 49.789f,
+    47.725f, 45.755f, 43.867f, 42.051f, 40.299f, 38.603f,
+    36.957f, 35.355f, 33.792f, 32.264f, 30.765f, 29.293f,
+    27.844f, 26.414f, 25.000f, 23.600f, 22.210f, 20.827f,
+    19.450f, 18.074f, 16.698f, 15.317f, 13.931f, 12.534f,
+    11.125f, 9.699f, 8.253f, 6.782f, 5.281f, 3.746f,
+    2.169f, 0.545f, -1.136f, -2.884f, -4.711f, -6.632f,
+    -8.666f, -10.839f, -13.184f, -15.746f, -18.591f, -21.821f,
+    -25.601f, -30.232f, -36.373f, -40.000f, -40.000f
+};
+
+// Termokopel tipe K (NIST ITS-90): emf (uV) per suhu, untuk cold junction
+#define ADC_LUT_CJ_T_MIN        (-20.0f)
+#define ADC_LUT_CJ_T_STEP       5.0f
+#define ADC_LUT_CJ_POINTS       21
+static const float adc_lut_tc_emf_uv[21] = {
+    -777.540f, -585.535f, -391.854f, -196.622f, 0.000f, 197.851f,
+    396.862f, 596.972f, 798.120f, 1000.242f, 1203.275f, 1407.149f,
+    1611.792f, 1817.128f, 2023.078f, 2229.555f, 2436.472f, 2643.734f,
+    2851.249f, 3058.917f, 3266.642f
+};
+
+// Termokopel tipe K: suhu (C) per emf, langkah seragam
+#define ADC_LUT_TC_EMF_STEP_UV  500.0f
+#define ADC_LUT_TC_POINTS       51
+static const float adc_lut_tc_temp_c[51] = {
+    0.000f, 12.580f, 24.994f, 37.271f, 49.440f, 61.533f,
+    73.582f, 85.618f, 97.675f, 109.780f, 121.957f, 134.218f,
+    146.568f, 158.997f, 171.486f, 184.008f, 196.534f, 209.037f,
+    221.495f, 233.895f, 246.230f, 258.499f, 270.708f, 282.861f,
+    294.964f, 307.025f, 319.049f, 331.039f, 343.000f, 354.934f,
+    366.843f, 378.728f, 390.592f, 402.435f, 414.258f, 426.064f,
+    437.853f, 449.628f, 461.390f, 473.140f, 484.881f, 496.615f,
+    508.343f, 520.069f, 531.792f, 543.517f, 555.244f, 566.977f,
+    578.716f, 590.465f, 602.224f
+};
+
+// Q16.16: suhu (C) dan emf cold junction sebagai posisi di adc_lut_tc_temp_q16
+static const int32_t adc_lut_ntc_temp_q16[65] = {
+    9830400, 9830400, 8475165, 7388465, 6658564, 6111905,
+    5675773, 5313083, 5002468, 4730543, 4488390, 4269782,
+    4070204, 3886280, 3715424, 3555609, 3405218, 3262940,
+    3127696, 2998587, 2874854, 2755853, 2641024, 2529886,
+    2422013, 2317030, 2214601, 2114423, 2016222, 1919745,
+    1824759, 1731046, 1638400, 1546624, 1455529, 1364930,
+    1274645, 1184493, 1094289, 1003847, 912972, 821459,
+    729093, 635641, 540850, 444441, 346101, 245478,
+    142169, 35703, -74472, -189018, -308740, -434634,
+    -567962, -710359, -864005, -1031907, -1218398, -1430075,
+    -1677765, -1981280, -2383730, -2621440, -2621440
+};
+static const int32_t adc_lut_tc_cj_pos_q16[21] = {
+    -101914, -76747, -51361, -25772, 0, 25933,
+    52017, 78246, 104611, 131104, 157716, 184438,
+    211261, 238175, 265169, 292232, 319353, 346520,
+    373719, 400938, 428165
+};
+static const int32_t adc_lut_tc_temp_q16[51] = {
+    0, 824467, 1638008, 2442582, 3240126, 4032649,
+    4822251, 5611077, 6401216, 7194545, 7992549, 8796137,
+    9605499, 10420053, 11238525, 12059166, 12880058, 13699428,
+    14515880, 15328511, 16136900, 16941018, 17741105, 18537546,
+    19330772, 20121193, 20909166, 21694978, 22478850, 23260951,
+    24041412, 24820339, 25597824, 26373957, 27148826, 27922525,
+    28695154, 29466818, 30237631, 31007710, 31777178, 32546163,
+    33314796, 34083210, 34851540, 35619922, 36388493, 37157390,
+    37926746, 38696696, 39467370
+};
+
+#endif
\ No newline at end of file
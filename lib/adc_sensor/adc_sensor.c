@@ -1,13 +1,269 @@
 #include "adc_sensor.h"
+#include "adc_calib.h"
 #include "gd32f3x0.h"
 #include "delay.h"
+#include "pwm_timer0.h"
 #include <arm_math.h>
 
-// Buffer DMA harus berukuran 3 jika semua masuk Regular Group
-// [0]=T12 (PA0), [1]=Hot Air (PA1), [2]=NTC (PA2)
-static uint16_t adc_dma_buffer[3]; 
+// Buffer DMA ping-pong: dua blok ADC_OVERSAMPLE scan, tiap scan ADC_BUFFER_SIZE channel
+// Regular Group dengan urutan ADC_CHANNEL_TABLE (indeks ADC_CH_*)
+// Interupsi half-transfer = blok 0 penuh, full-transfer = blok 1 penuh; DMA sementara
+// mengisi blok yang lain, jadi blok yang dijumlahkan tidak sedang ditimpa.
+static uint16_t adc_dma_buffer[2][ADC_OVERSAMPLE][ADC_BUFFER_SIZE];
 volatile adc_sensor_t g_adc_data = {0};
 
+// Hasil blok terakhir (ditulis ISR, dibaca di dalam critical section)
+static volatile uint32_t adc_sums[ADC_BUFFER_SIZE];
+static volatile uint32_t adc_seq = 0;          // 0 = belum ada blok
+static volatile uint32_t adc_block_cycles = 0; // DWT CYCCNT saat blok adc_seq selesai
+
+_Static_assert(ADC_BUFFER_SIZE <= 16, "Scan regular maksimal 16 channel");
+
+// Filter per channel (hanya disentuh ISR, kecuali saat konfigurasi dengan IRQ mati)
+typedef struct {
+    uint16_t history[ADC_FILTER_MEDIAN];  // Sampel terakhir untuk median (termasuk blok sebelumnya)
+    uint8_t head;                         // Posisi sampel tertua di history
+    float b0, a1, a2;                     // Butterworth: b1 = 2*b0, b2 = b0
+    float x1, x2, y1, y2;                 // State direct form I
+    bool lowpass;
+    bool primed;
+} adc_filter_t;
+
+static adc_filter_t adc_filters[ADC_BUFFER_SIZE];
+
+// Deteksi fault per channel (ISR), status di-latch sampai adc_sensor_clear_faults
+typedef struct {
+    uint16_t min_code, max_code;    // Rentang rata-rata blok yang masuk akal
+    uint16_t max_step;              // Perubahan rata-rata maksimal per blok
+    uint8_t pwm_mask;               // Channel heater yang dimatikan (bit pwm_channel_t)
+} adc_fault_limit_t;
+
+// Konfigurasi per channel dari ADC_CHANNEL_TABLE
+typedef struct {
+    uint8_t adc_channel;
+    uint32_t sample_time;
+    uint8_t decimation;             // Blok per hasil yang diterbitkan
+    float lowpass_hz;
+    adc_fault_limit_t fault;
+} adc_channel_cfg_t;
+
+#define ADC_CH_CFG(id, field, ch, pin, smp, dec, lp, fmin, fmax, fstep, pwm) \
+    {ch, smp, dec, lp, {fmin, fmax, fstep, pwm}},
+static const adc_channel_cfg_t adc_channels[ADC_BUFFER_SIZE] = {
+    ADC_CHANNEL_TABLE(ADC_CH_CFG)
+};
+#undef ADC_CH_CFG
+
+#define ADC_CH_PIN(id, field, ch, pin, smp, dec, lp, fmin, fmax, fstep, pwm) | (pin)
+#define ADC_GPIO_PINS   (0 ADC_CHANNEL_TABLE(ADC_CH_PIN))
+
+// Akumulasi blok untuk channel dengan decimation > 1
+typedef struct {
+    uint32_t sum;
+    uint16_t min_raw, max_raw;
+    uint8_t blocks;
+} adc_decim_t;
+
+static adc_decim_t adc_decim[ADC_BUFFER_SIZE];
+
+static volatile uint32_t adc_fault_status = 0;
+static uint16_t adc_fault_prev_mean[ADC_BUFFER_SIZE];
+static uint16_t adc_fault_stuck_blocks[ADC_BUFFER_SIZE];
+static uint32_t adc_fault_have_prev = 0;       // Bit per channel: prev_mean valid
+static uint32_t adc_fault_counters[ADC_BUFFER_SIZE][ADC_FAULT_KINDS];
+
+// Analog watchdog: ambang per channel termokopel, channel yang sedang dipantau
+_Static_assert(ADC_CH_T12 == 0 && ADC_CH_HOT_AIR == 1, "Watchdog mengindeks termokopel 0/1");
+static uint16_t adc_wdt_threshold[2];
+static volatile uint8_t adc_wdt_channel = 0;
+
+// Sampel injected T12 dari jendela blanking sejak blok terakhir
+#if PWM_BLANK_ENABLE
+static volatile uint32_t adc_blank_sum = 0;
+static volatile uint16_t adc_blank_count = 0;
+#endif
+
+// Hook kontrol di konteks ISR
+static volatile adc_block_hook_t block_hook = NULL;
+static uint16_t hook_every = 1;
+static uint16_t hook_count = 0;
+
+// Notifikasi task saat blok selesai
+static volatile uint16_t notify_task_id = 0xFFFF;
+static volatile uint32_t notify_mask = 0;
+static uint16_t notify_every = 1;
+static uint16_t notify_count = 0;
+
+// Butterworth orde 2 (bilinear) pada laju terbit channel; b dinormalkan dari a agar gain DC tepat 1
+static void adc_filter_config(adc_filter_t *f, float cutoff_hz, uint8_t decimation) {
+    const float fs = (float)PWM_FREQ_HZ / (ADC_OVERSAMPLE * decimation);
+    if (cutoff_hz <= 0.0f || cutoff_hz >= fs * 0.45f) {
+        f->lowpass = false;
+        return;
+    }
+    float k = tanf(3.14159265f * cutoff_hz / fs);
+    float norm = 1.0f / (1.0f + 1.41421356f * k + k * k);
+    f->a1 = 2.0f * (k * k - 1.0f) * norm;
+    f->a2 = (1.0f - 1.41421356f * k + k * k) * norm;
+    f->b0 = (1.0f + f->a1 + f->a2) * 0.25f;
+    f->primed = false;
+    f->lowpass = true;
+}
+
+#if ADC_FILTER_MEDIAN == 3
+static inline uint16_t median_of(const uint16_t *v) {
+    uint16_t lo = (v[0] < v[1]) ? v[0] : v[1];
+    uint16_t hi = (v[0] < v[1]) ? v[1] : v[0];
+    return (v[2] < lo) ? lo : ((v[2] > hi) ? hi : v[2]);
+}
+#elif ADC_FILTER_MEDIAN == 5
+#define SORT2(a, b) do { if ((a) > (b)) { uint16_t t_ = (a); (a) = (b); (b) = t_; } } while (0)
+static inline uint16_t median_of(const uint16_t *v) {
+    uint16_t a = v[0], b = v[1], c = v[2], d = v[3], e = v[4];
+    SORT2(a, b); SORT2(d, e); SORT2(a, c); SORT2(b, c);
+    SORT2(a, d); SORT2(c, d); SORT2(b, e); SORT2(b, c);
+    return c;
+}
+#endif
+
+// Satu channel satu blok: median per sampel lalu jumlah; min/max sampel mentah untuk deteksi stuck
+static uint32_t adc_median_block(adc_filter_t *f, uint16_t (*scans)[ADC_BUFFER_SIZE], uint8_t ch,
+                                 uint16_t *min_raw, uint16_t *max_raw) {
+    uint32_t sum = 0;
+    uint16_t lo = 0xFFFF, hi = 0;
+#if ADC_FILTER_MEDIAN > 1
+    if (!f->primed) {
+        for (uint8_t k = 0; k < ADC_FILTER_MEDIAN; k++) {
+            f->history[k] = scans[0][ch];
+        }
+        f->head = 0;
+    }
+    uint8_t head = f->head;
+    for (uint16_t i = 0; i < ADC_OVERSAMPLE; i++) {
+        uint16_t x = scans[i][ch];
+        if (x < lo) lo = x;
+        if (x > hi) hi = x;
+        f->history[head] = x;
+        head = (head + 1 < ADC_FILTER_MEDIAN) ? head + 1 : 0;
+        sum += median_of(f->history);
+    }
+    f->head = head;
+#else
+    for (uint16_t i = 0; i < ADC_OVERSAMPLE; i++) {
+        uint16_t x = scans[i][ch];
+        if (x < lo) lo = x;
+        if (x > hi) hi = x;
+        sum += x;
+    }
+#endif
+    *min_raw = lo;
+    *max_raw = hi;
+    return sum;
+}
+
+// Low-pass pada laju blok, hasil tetap skala jumlah
+static uint32_t adc_lowpass_step(adc_filter_t *f, uint32_t sum) {
+    if (f->lowpass) {
+        float x = (float)sum;
+        if (!f->primed) {
+            f->x1 = f->x2 = f->y1 = f->y2 = x;   // Mulai dari kondisi tunak, bukan dari 0
+        }
+        float y = f->b0 * (x + 2.0f * f->x1 + f->x2) - f->a1 * f->y1 - f->a2 * f->y2;
+        f->x2 = f->x1;
+        f->x1 = x;
+        f->y2 = f->y1;
+        f->y1 = y;
+        sum = (y > 0.0f) ? (uint32_t)(y + 0.5f) : 0;
+    }
+    f->primed = true;
+    return sum;
+}
+
+// Status dan counter fault ditulis dari ISR DMA, ISR ADC_CMP (prioritas lebih tinggi) dan
+// thread (clear), jadi setiap read-modify-write dilakukan dengan interupsi mati
+static void adc_fault_latch(uint8_t ch, uint32_t found) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    for (uint8_t kind = 0; kind < ADC_FAULT_KINDS; kind++) {
+        if (found & ADC_FAULT_BIT(ch, kind)) {
+            adc_fault_counters[ch][kind]++;
+        }
+    }
+    adc_fault_status |= found;
+    __set_PRIMASK(primask);
+}
+
+// Cek rentang, laju perubahan dan nilai macet dari rata-rata blok (sebelum low-pass).
+// Fault baru langsung mematikan heater terkait dan di-latch.
+static void adc_fault_check(uint8_t ch, uint32_t median_sum, uint16_t min_raw, uint16_t max_raw) {
+    const adc_fault_limit_t *lim = &adc_channels[ch].fault;
+    uint16_t mean = (uint16_t)((median_sum + ADC_OVERSAMPLE / 2) / ADC_OVERSAMPLE);
+    uint32_t found = 0;
+
+    if (mean < lim->min_code || mean > lim->max_code) {
+        found |= ADC_FAULT_BIT(ch, ADC_FAULT_RANGE);
+    }
+    if (adc_fault_have_prev & (1UL << ch)) {
+        uint16_t prev = adc_fault_prev_mean[ch];
+        uint16_t step = (mean > prev) ? mean - prev : prev - mean;
+        if (step > lim->max_step) {
+            found |= ADC_FAULT_BIT(ch, ADC_FAULT_RATE);
+        }
+    }
+    adc_fault_prev_mean[ch] = mean;
+    adc_fault_have_prev |= 1UL << ch;
+
+    // Sinyal analog nyata selalu punya noise >= 1 LSB dalam satu blok; dekat 0 dikecualikan
+    // (output op-amp termokopel menempel di rail saat ujung dingin) dan 4095 sudah ditangkap rentang.
+    // Channel informasi (tanpa heater) boleh tenang, misalnya resistor ID tip.
+    if (lim->pwm_mask != 0 &&
+        min_raw == max_raw && min_raw > ADC_FAULT_STUCK_MIN_CODE && max_raw < 4095) {
+        if (adc_fault_stuck_blocks[ch] < ADC_FAULT_STUCK_BLOCKS) {
+            adc_fault_stuck_blocks[ch]++;
+        }
+        if (adc_fault_stuck_blocks[ch] >= ADC_FAULT_STUCK_BLOCKS) {
+            found |= ADC_FAULT_BIT(ch, ADC_FAULT_STUCK);
+        }
+    } else {
+        adc_fault_stuck_blocks[ch] = 0;
+    }
+
+    if (found == 0) {
+        return;
+    }
+    adc_fault_latch(ch, found);
+    for (uint8_t pwm = 0; pwm <= PWM_CH_FAN; pwm++) {
+        if (lim->pwm_mask & (1u << pwm)) {
+            pwm_timer0_force_off((pwm_channel_t)pwm);
+        }
+    }
+}
+
+// Pantau satu channel termokopel (0 = T12/ADC_CHANNEL_0, 1 = Hot Air/ADC_CHANNEL_1)
+static void adc_wdt_select(uint8_t ch) {
+    adc_wdt_channel = ch;
+    adc_watchdog_threshold_config(0, adc_wdt_threshold[ch]);
+    adc_watchdog_single_channel_enable((ch == 0) ? ADC_CHANNEL_0 : ADC_CHANNEL_1);
+#if PWM_BLANK_ENABLE
+    // Konversi regular T12 tersampel saat heater ON (spike PWM): hanya konversi injected
+    // di jendela blanking yang dipantau. SPL selalu menyalakan RWDEN dan IWDEN.
+    if (ch == 0) {
+        ADC_CTL0 &= ~ADC_CTL0_RWDEN;
+    }
+#endif
+}
+
+static void adc_wdt_init(void) {
+#if ADC_WDT_ENABLE
+    adc_wdt_threshold[0] = adc_tc_temp_to_code(ADC_WDT_T12_MAX_C, ADC_WDT_AMBIENT_MAX_C);
+    adc_wdt_threshold[1] = adc_tc_temp_to_code(ADC_WDT_HOT_AIR_MAX_C, ADC_WDT_AMBIENT_MAX_C);
+    adc_wdt_select(0);
+    adc_interrupt_flag_clear(ADC_INT_FLAG_WDE);
+    adc_interrupt_enable(ADC_INT_WDE);
+    nvic_irq_enable(ADC_CMP_IRQn, IRQ_PRIORITY_HEATER_SAFETY, 0);
+#endif
+}
+
 void adc_sensor_init(void) {
     // 1. Clock Enable
     rcu_periph_clock_enable(RCU_GPIOA);
@@ -16,7 +272,12 @@ void adc_sensor_init(void) {
     rcu_adc_clock_config(RCU_ADCCK_AHB_DIV3);
 
     // 2. GPIO Konfigurasi
-    gpio_mode_set(GPIOA, GPIO_MODE_ANALOG, GPIO_PUPD_NONE, GPIO_PIN_0 | GPIO_PIN_1 | GPIO_PIN_2);
+    gpio_mode_set(GPIOA, GPIO_MODE_ANALOG, GPIO_PUPD_NONE, ADC_GPIO_PINS);
+
+    // Filter default per channel
+    for (uint8_t ch = 0; ch < ADC_BUFFER_SIZE; ch++) {
+        adc_filter_config(&adc_filters[ch], adc_channels[ch].lowpass_hz, adc_channels[ch].decimation);
+    }
 
     // 3. DMA Konfigurasi (DMA_CH0 untuk ADC di GD32F3x0)
     dma_deinit(DMA_CH0);
@@ -30,30 +291,48 @@ void adc_sensor_init(void) {
     dma_init_struct.periph_addr = (uint32_t)(&ADC_RDATA); // Register data regular
     dma_init_struct.periph_inc = DMA_PERIPH_INCREASE_DISABLE;
     dma_init_struct.periph_width = DMA_PERIPHERAL_WIDTH_16BIT;
-    dma_init_struct.number = 3; // Mengambil 3 channel
+    dma_init_struct.number = 2 * ADC_OVERSAMPLE * ADC_BUFFER_SIZE; // Dua blok ping-pong
     dma_init_struct.priority = DMA_PRIORITY_HIGH;
     
     dma_init(DMA_CH0, &dma_init_struct);
     dma_circulation_enable(DMA_CH0);
+
+    dma_interrupt_flag_clear(DMA_CH0, DMA_INT_FLAG_G);
+    dma_interrupt_enable(DMA_CH0, DMA_INT_HTF | DMA_INT_FTF);
+    nvic_irq_enable(DMA_Channel0_IRQn, IRQ_PRIORITY_ADC_DMA, 0);
     
 
     // 4. ADC Konfigurasi (Regular Scan Mode)
     adc_deinit();
     
     adc_special_function_config(ADC_SCAN_MODE, ENABLE);
-    adc_special_function_config(ADC_CONTINUOUS_MODE, ENABLE); // Trigger via Timer
+    adc_special_function_config(ADC_CONTINUOUS_MODE, DISABLE); // Satu scan per trigger timer
     adc_data_alignment_config(ADC_DATAALIGN_RIGHT);
     
-    // Urutan Scan: Rank 0=PA0, Rank 1=PA1, Rank 2=PA2
-    adc_regular_channel_config(0, ADC_CHANNEL_0, ADC_SAMPLETIME_55POINT5);
-    adc_regular_channel_config(1, ADC_CHANNEL_1, ADC_SAMPLETIME_239POINT5);
-    adc_regular_channel_config(2, ADC_CHANNEL_2, ADC_SAMPLETIME_239POINT5);
-    adc_channel_length_config(ADC_REGULAR_CHANNEL, 3);
-
-    // Setup Trigger Hardware dari Timer 0 (PWM Valley)
-    adc_external_trigger_source_config(ADC_REGULAR_CHANNEL, ADC_EXTTRIG_REGULAR_T0_CH0);
+    // Urutan Scan = urutan ADC_CHANNEL_TABLE
+    for (uint8_t rank = 0; rank < ADC_BUFFER_SIZE; rank++) {
+        adc_regular_channel_config(rank, adc_channels[rank].adc_channel, adc_channels[rank].sample_time);
+    }
+    adc_channel_length_config(ADC_REGULAR_CHANNEL, ADC_BUFFER_SIZE);
+
+    // Setup Trigger Hardware: TIMER1 CH1, sefase dengan lembah PWM TIMER0 (lihat pwm_timer0.c)
+    adc_external_trigger_source_config(ADC_REGULAR_CHANNEL, ADC_EXTTRIG_REGULAR_T1_CH1);
     adc_external_trigger_config(ADC_REGULAR_CHANNEL, ENABLE);
     
+    // Over-temperature hardware (sebelum ADC jalan)
+    adc_wdt_init();
+
+#if PWM_BLANK_ENABLE
+    // Injected: satu konversi T12 dipicu TIMER0 CH3 di jendela blanking
+    adc_channel_length_config(ADC_INSERTED_CHANNEL, 1);
+    adc_inserted_channel_config(0, ADC_CHANNEL_0, ADC_SAMPLETIME_55POINT5);
+    adc_external_trigger_source_config(ADC_INSERTED_CHANNEL, ADC_EXTTRIG_INSERTED_T0_CH3);
+    adc_external_trigger_config(ADC_INSERTED_CHANNEL, ENABLE);
+    adc_interrupt_flag_clear(ADC_INT_FLAG_EOIC);
+    adc_interrupt_enable(ADC_INT_EOIC);
+    nvic_irq_enable(ADC_CMP_IRQn, IRQ_PRIORITY_HEATER_SAFETY, 0);
+#endif
+
      // 4. Aktifkan ADC
     adc_dma_mode_enable(); // Hubungkan ADC ke DMA
     adc_enable();
@@ -71,40 +350,252 @@ void adc_sensor_stop(void){
     dma_channel_disable(DMA_CH0);
 }
 
+void adc_sensor_notify_task(uint16_t task_id, uint32_t event_mask, uint16_t every_n) {
+    nvic_irq_disable(DMA_Channel0_IRQn);
+    notify_task_id = task_id;
+    notify_mask = event_mask;
+    notify_every = (every_n > 0) ? every_n : 1;
+    notify_count = 0;
+    nvic_irq_enable(DMA_Channel0_IRQn, IRQ_PRIORITY_ADC_DMA, 0);
+}
+
+// Filter dan jumlahkan satu blok (decimation ADC_OVERSAMPLE:1) lalu beri tahu task
+#if PWM_BLANK_ENABLE
+// Rata-rata sampel blanking diskalakan ke jumlah ADC_OVERSAMPLE; 0 jika belum ada sampel
+static uint8_t adc_blank_take(uint32_t *sum) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    uint32_t total = adc_blank_sum;
+    uint16_t count = adc_blank_count;
+    adc_blank_sum = 0;
+    adc_blank_count = 0;
+    __set_PRIMASK(primask);
+
+    if (count == 0) return 0;
+    *sum = (total * ADC_OVERSAMPLE + count / 2) / count;
+    return 1;
+}
+#endif
+
+// Rata-rata 'decimation' blok; 0 jika hasil channel belum waktunya diterbitkan
+static uint8_t adc_decimate(uint8_t ch, uint32_t *sum, uint16_t *min_raw, uint16_t *max_raw) {
+    adc_decim_t *d = &adc_decim[ch];
+    if (d->blocks == 0) {
+        d->sum = 0;
+        d->min_raw = *min_raw;
+        d->max_raw = *max_raw;
+    }
+    d->sum += *sum;
+    if (*min_raw < d->min_raw) d->min_raw = *min_raw;
+    if (*max_raw > d->max_raw) d->max_raw = *max_raw;
+    if (++d->blocks < adc_channels[ch].decimation) {
+        return 0;
+    }
 
-// Implementasi fungsi konversi sesuai header Anda
-float adc_raw_to_voltage(uint16_t raw) {
-    return (raw * ADC_VREF) / ADC_MAX_VALUE;
+    *sum = (d->sum + d->blocks / 2) / d->blocks;
+    *min_raw = d->min_raw;
+    *max_raw = d->max_raw;
+    d->blocks = 0;
+    return 1;
 }
 
-float adc_compensate_op07_bias(float adc_voltage) {
-    return (adc_voltage - OP07_BIAS_VOLTAGE) / THERMOCOUPLE_GAIN;
+static void adc_block_complete(uint16_t (*scans)[ADC_BUFFER_SIZE]) {
+    uint32_t sum[ADC_BUFFER_SIZE];
+    for (uint8_t ch = 0; ch < ADC_BUFFER_SIZE; ch++) {
+        uint16_t min_raw, max_raw;
+        uint32_t median_sum = adc_median_block(&adc_filters[ch], scans, ch, &min_raw, &max_raw);
+#if PWM_BLANK_ENABLE
+        if (ch == ADC_CH_T12 && !adc_blank_take(&median_sum)) {
+            sum[ch] = adc_sums[ch];
+            continue;
+        }
+#endif
+        if (adc_channels[ch].decimation > 1 && !adc_decimate(ch, &median_sum, &min_raw, &max_raw)) {
+            sum[ch] = adc_sums[ch];
+            continue;
+        }
+        adc_fault_check(ch, median_sum, min_raw, max_raw);
+        sum[ch] = adc_lowpass_step(&adc_filters[ch], median_sum);
+        adc_sums[ch] = sum[ch];
+    }
+
+#if ADC_WDT_ENABLE && ADC_WDT_ROTATE
+    // Pantau termokopel lain selama blok berikutnya (jika watchdog belum terpicu)
+    if (!(adc_fault_status & (ADC_FAULT_BIT(0, ADC_FAULT_OVERTEMP) | ADC_FAULT_BIT(1, ADC_FAULT_OVERTEMP)))) {
+        adc_wdt_select(adc_wdt_channel ^ 1);
+    }
+#endif
+    uint32_t seq = adc_seq + 1;
+    if (seq == 0) seq = 1; // 0 dicadangkan untuk "belum ada blok"
+    adc_block_cycles = DWT->CYCCNT;
+    adc_seq = seq;
+
+    adc_block_hook_t hook = block_hook;
+    if (hook != NULL && ++hook_count >= hook_every) {
+        hook_count = 0;
+        hook(sum, seq);
+    }
+
+    if (notify_mask != 0 && ++notify_count >= notify_every) {
+        notify_count = 0;
+        task_post_event(notify_task_id, notify_mask);
+    }
+}
+
+#if ADC_WDT_ENABLE || PWM_BLANK_ENABLE
+// Watchdog: satu konversi di atas ambang, heater langsung mati dan di-latch. Interupsi
+// dimatikan sampai adc_sensor_clear_faults agar tidak berulang setiap konversi.
+// Blanking: pulihkan duty T12 dulu (jendela sesingkat mungkin), baru simpan sampel.
+void ADC_CMP_IRQHandler(void) {
+#if PWM_BLANK_ENABLE
+    if (adc_interrupt_flag_get(ADC_INT_FLAG_EOIC)) {
+        adc_interrupt_flag_clear(ADC_INT_FLAG_EOIC);
+        pwm_timer0_blank_end();
+        adc_blank_sum += adc_inserted_data_read(ADC_INSERTED_CHANNEL_0);
+        adc_blank_count++;
+    }
+#endif
+#if ADC_WDT_ENABLE
+    if (adc_interrupt_flag_get(ADC_INT_FLAG_WDE)) {
+        adc_interrupt_flag_clear(ADC_INT_FLAG_WDE);
+        uint8_t ch = adc_wdt_channel;
+        pwm_timer0_force_off((ch == 0) ? PWM_CH_T12_HEATER : PWM_CH_HOT_AIR_HEATER);
+        adc_interrupt_disable(ADC_INT_WDE);
+        adc_fault_latch(ch, ADC_FAULT_BIT(ch, ADC_FAULT_OVERTEMP));
+    }
+#endif
 }
+#endif
 
-float adc_calc_ambient_temp(float ntc_voltage) {
-    if (ntc_voltage <= 0.05f || ntc_voltage >= (ADC_VREF - 0.05f)) return 25.0f;
-    float r_ntc = (ntc_voltage * NTC_R_SERIES) / (ADC_VREF - ntc_voltage);
-    float ln_r = logf(r_ntc / NTC_R0);
-    float temp_k = 1.0f / ((1.0f / 298.15f) + (1.0f / NTC_BETA) * ln_r);
-    return temp_k - 273.15f;
+void DMA_Channel0_IRQHandler(void) {
+    if (dma_interrupt_flag_get(DMA_CH0, DMA_INT_FLAG_HTF)) {
+        dma_interrupt_flag_clear(DMA_CH0, DMA_INT_FLAG_HTF);
+        adc_block_complete(adc_dma_buffer[0]);
+    }
+    if (dma_interrupt_flag_get(DMA_CH0, DMA_INT_FLAG_FTF)) {
+        dma_interrupt_flag_clear(DMA_CH0, DMA_INT_FLAG_FTF);
+        adc_block_complete(adc_dma_buffer[1]);
+    }
 }
 
-float adc_calc_thermocouple_temp(float tc_voltage, float ambient_temp) {
-    // Voltase TC dalam Volt, THERMOCOUPLE_UV_PER_C dalam uV/C
-    float compensated_voltage = tc_voltage + (ambient_temp * THERMOCOUPLE_UV_PER_C * 1e-6f);
-    return compensated_voltage / (THERMOCOUPLE_UV_PER_C * 1e-6f);
+uint32_t adc_sensor_get_sums(uint32_t sums[ADC_BUFFER_SIZE]) {
+    return adc_sensor_get_sums_stamped(sums, NULL);
 }
 
+uint32_t adc_sensor_get_sums_stamped(uint32_t sums[ADC_BUFFER_SIZE], uint32_t *block_cycles) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    for (uint8_t ch = 0; ch < ADC_BUFFER_SIZE; ch++) {
+        sums[ch] = adc_sums[ch];
+    }
+    uint32_t seq = adc_seq;
+    if (block_cycles != NULL) {
+        *block_cycles = adc_block_cycles;
+    }
+    __set_PRIMASK(primask);
+    return seq;
+}
+
+uint32_t adc_sensor_sequence(void) {
+    return adc_seq;
+}
+
+uint32_t adc_sensor_get_fault_status(void) {
+    return adc_fault_status;
+}
+
+uint32_t adc_sensor_get_fault_count(uint8_t channel, adc_fault_kind_t kind) {
+    if (channel >= ADC_BUFFER_SIZE || kind >= ADC_FAULT_KINDS) {
+        return 0;
+    }
+    return adc_fault_counters[channel][kind];
+}
+
+// Hapus latch; heater hanya dilepas jika tidak ada fault lain yang memakainya.
+// Kondisi yang masih ada akan ter-latch lagi di blok berikutnya. Semua interupsi mati
+// (termasuk ADC_CMP), jadi OVERTEMP tidak bisa ter-set di antara cek dan release.
+void adc_sensor_clear_faults(uint32_t mask) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    adc_fault_status &= ~mask;
+    uint8_t still_off = 0;
+    for (uint8_t ch = 0; ch < ADC_BUFFER_SIZE; ch++) {
+        if (adc_fault_status & ADC_FAULT_CHANNEL_MASK(ch)) {
+            still_off |= adc_channels[ch].fault.pwm_mask;
+        }
+        adc_fault_stuck_blocks[ch] = 0;
+    }
+    adc_fault_have_prev = 0;
+    for (uint8_t pwm = 0; pwm <= PWM_CH_FAN; pwm++) {
+        if (!(still_off & (1u << pwm))) {
+            pwm_timer0_release((pwm_channel_t)pwm);
+        }
+    }
+#if ADC_WDT_ENABLE
+    if (!(adc_fault_status & (ADC_FAULT_BIT(0, ADC_FAULT_OVERTEMP) | ADC_FAULT_BIT(1, ADC_FAULT_OVERTEMP)))) {
+        adc_interrupt_flag_clear(ADC_INT_FLAG_WDE);
+        adc_interrupt_enable(ADC_INT_WDE);
+    }
+#endif
+    __set_PRIMASK(primask);
+}
+
+uint16_t adc_sensor_get_wdt_threshold(uint8_t channel) {
+    return (channel < 2) ? adc_wdt_threshold[channel] : 0;
+}
+
+void adc_sensor_set_lowpass(uint8_t channel, float cutoff_hz) {
+    if (channel >= ADC_BUFFER_SIZE) {
+        return;
+    }
+    nvic_irq_disable(DMA_Channel0_IRQn);
+    adc_filter_config(&adc_filters[channel], cutoff_hz, adc_channels[channel].decimation);
+    nvic_irq_enable(DMA_Channel0_IRQn, IRQ_PRIORITY_ADC_DMA, 0);
+}
+
+void adc_sensor_set_block_hook(adc_block_hook_t hook, uint16_t every_n) {
+    nvic_irq_disable(DMA_Channel0_IRQn);
+    block_hook = hook;
+    hook_every = (every_n > 0) ? every_n : 1;
+    hook_count = 0;
+    nvic_irq_enable(DMA_Channel0_IRQn, IRQ_PRIORITY_ADC_DMA, 0);
+}
+
+
 uint8_t adc_sensor_get_data(volatile adc_sensor_t *data) {
-    // Ambil raw data dari buffer DMA
-    data->t12_raw      = adc_dma_buffer[0];
-    data->hot_air_raw  = adc_dma_buffer[1];
-    data->ntc_raw      = adc_dma_buffer[2];
+    // Ambil hasil oversampling blok terakhir (bukan buffer yang sedang diisi DMA)
+    uint32_t sums[ADC_BUFFER_SIZE];
+    uint32_t block_cycles;
+    uint32_t seq = adc_sensor_get_sums_stamped(sums, &block_cycles);
+    if (seq == 0 || seq == data->seq) {
+        data->data_ready = 0;
+        return 0;
+    }
+    data->seq = seq;
+    data->block_cycles = block_cycles;
+
+    // Raw tetap 12-bit (rata-rata dibulatkan) untuk kompatibilitas, tegangan resolusi penuh
+#define ADC_DATA_FILL(id, field, ch, pin, smp, dec, lp, fmin, fmax, fstep, pwm) \
+    data->field##_raw = (uint16_t)((sums[ADC_CH_##id] + ADC_OVERSAMPLE / 2) / ADC_OVERSAMPLE); \
+    data->field##_voltage = adc_sum_to_voltage(sums[ADC_CH_##id]);
+    ADC_CHANNEL_TABLE(ADC_DATA_FILL)
+#undef ADC_DATA_FILL
 
-    // Proses konversi sesuai rumus di header
-    data->t12_voltage      = adc_raw_to_voltage(data->t12_raw);
-    data->hot_air_voltage  = adc_raw_to_voltage(data->hot_air_raw);
-    data->ntc_voltage      = adc_raw_to_voltage(data->ntc_raw);
+#if ADC_SCAN_SUPPLY
+    data->supply_v = data->supply_voltage * ADC_SUPPLY_DIVIDER;
+#endif
+#if ADC_SCAN_HEATER_CURRENT
+    data->heater_current_a = data->heater_current_voltage * (1.0f / (ADC_CURRENT_SHUNT_OHM * ADC_CURRENT_GAIN));
+#endif
+#if ADC_SCAN_SUPPLY && ADC_SCAN_HEATER_CURRENT
+    data->heater_power_w = data->supply_v * data->heater_current_a;
+    data->heater_load_ohm = (data->heater_current_a > 0.05f) ? data->supply_v / data->heater_current_a : 0.0f;
+#endif
+#if ADC_SCAN_TIP_ID
+    // Pembagi pull-up: R = Rpu * v / (VREF - v); rel atas = tip tidak terpasang
+    float v_id = data->tip_id_voltage;
+    data->tip_id_ohm = (v_id < ADC_VREF - 0.01f) ? ADC_TIP_ID_PULLUP_OHM * v_id / (ADC_VREF - v_id) : 0.0f;
+#endif
 
     data->ambient_temp_c   = adc_calc_ambient_temp(data->ntc_voltage);
     
@@ -112,8 +603,11 @@ uint8_t adc_sensor_get_data(volatile adc_sensor_t *data) {
     float v_tc_t12 = adc_compensate_op07_bias(data->t12_voltage);
     float v_tc_air = adc_compensate_op07_bias(data->hot_air_voltage);
 
-    data->t12_temp_c       = adc_calc_thermocouple_temp(v_tc_t12, data->ambient_temp_c);
-    data->hot_air_temp_c   = adc_calc_thermocouple_temp(v_tc_air, data->ambient_temp_c);
+    // Koreksi kalibrasi tip (tabel dari profil aktif, identitas jika belum dimuat)
+    data->t12_temp_c       = adc_calib_apply(ADC_CALIB_T12,
+                                 adc_calc_thermocouple_temp(v_tc_t12, data->ambient_temp_c));
+    data->hot_air_temp_c   = adc_calib_apply(ADC_CALIB_HOT_AIR,
+                                 adc_calc_thermocouple_temp(v_tc_air, data->ambient_temp_c));
 
     data->data_ready = 1;
     return 1;
@@ -1,52 +1,251 @@
 #ifndef ADC_SENSOR_H
 #define ADC_SENSOR_H
 
-#include <gd32f3x0.h>
 #include <stdint.h>
+#ifndef ADC_HOST_TEST
+#include <gd32f3x0.h>
+#endif
+#include "qmath.h"
+#include "pwm_timer0.h"
+
+// Oversampling: jumlah scan (trigger lembah PWM) yang dijumlahkan per channel
+// untuk satu hasil. 25 scan = 5 ms pada PWM 5 kHz (satu periode kontrol 200 Hz).
+#ifndef ADC_OVERSAMPLE
+#define ADC_OVERSAMPLE          25
+#endif
+#if ADC_OVERSAMPLE < 4 || ADC_OVERSAMPLE > 64
+#error "ADC_OVERSAMPLE harus 4..64"
+#endif
+// Filter per channel di ISR DMA, per blok: median-of-N per sampel (buang spike),
+// lalu rata-rata blok (decimation), lalu low-pass Butterworth orde 2 pada laju blok.
+// ADC_FILTER_MEDIAN: 1 = mati, 3 atau 5. Low-pass 0 Hz = mati (tanpa float di ISR).
+#ifndef ADC_FILTER_MEDIAN
+#define ADC_FILTER_MEDIAN       3
+#endif
+#if ADC_FILTER_MEDIAN != 1 && ADC_FILTER_MEDIAN != 3 && ADC_FILTER_MEDIAN != 5
+#error "ADC_FILTER_MEDIAN harus 1, 3 atau 5"
+#endif
+#ifndef ADC_FILTER_LP_HZ_T12
+#define ADC_FILTER_LP_HZ_T12    12.0f
+#endif
+#ifndef ADC_FILTER_LP_HZ_HOT_AIR
+#define ADC_FILTER_LP_HZ_HOT_AIR 12.0f
+#endif
+#ifndef ADC_FILTER_LP_HZ_NTC
+#define ADC_FILTER_LP_HZ_NTC    1.0f
+#endif
+#ifndef ADC_FILTER_LP_HZ_AUX
+#define ADC_FILTER_LP_HZ_AUX    2.0f    // Tegangan PSU / arus heater (setelah decimation)
+#endif
+// Batas deteksi fault (kode ADC rata-rata per blok)
+#ifndef ADC_FAULT_TC_OPEN_CODE
+#define ADC_FAULT_TC_OPEN_CODE  4000    // Termokopel putus: op-amp jenuh ke atas
+#endif
+#ifndef ADC_FAULT_NTC_MIN_CODE
+#define ADC_FAULT_NTC_MIN_CODE  62      // 0.05 V: NTC hubung singkat
+#endif
+#ifndef ADC_FAULT_NTC_MAX_CODE
+#define ADC_FAULT_NTC_MAX_CODE  4033    // VREF - 0.05 V: NTC terbuka/tidak terpasang
+#endif
+#ifndef ADC_FAULT_TC_MAX_STEP
+#define ADC_FAULT_TC_MAX_STEP   400     // ~55 C per blok 5 ms
+#endif
+#ifndef ADC_FAULT_NTC_MAX_STEP
+#define ADC_FAULT_NTC_MAX_STEP  200
+#endif
+#ifndef ADC_FAULT_STUCK_BLOCKS
+#define ADC_FAULT_STUCK_BLOCKS  40      // Blok berturut-turut tanpa noise sama sekali (200 ms)
+#endif
+#ifndef ADC_FAULT_STUCK_MIN_CODE
+#define ADC_FAULT_STUCK_MIN_CODE 16
+#endif
+
+// Analog watchdog hardware: ambang kode ADC dari suhu maksimum, ISR-nya langsung
+// mematikan heater di TIMER0 dalam satu konversi (tanpa menunggu scheduler).
+// Satu sampel di atas ambang sudah memicu, jadi beri margin di atas setpoint maksimum.
+#ifndef ADC_WDT_ENABLE
+#define ADC_WDT_ENABLE          1
+#endif
+#ifndef ADC_WDT_T12_MAX_C
+#define ADC_WDT_T12_MAX_C       480.0f
+#endif
+#ifndef ADC_WDT_HOT_AIR_MAX_C
+#define ADC_WDT_HOT_AIR_MAX_C   500.0f
+#endif
+#ifndef ADC_WDT_AMBIENT_MAX_C
+#define ADC_WDT_AMBIENT_MAX_C   50.0f   // Cold junction terpanas yang diasumsikan (ambang konservatif)
+#endif
+// Watchdog hanya bisa memantau satu channel: 0 = T12 saja, 1 = T12/Hot Air bergantian per blok
+#ifndef ADC_WDT_ROTATE
+#define ADC_WDT_ROTATE          0
+#endif
 
-// Konstanta
-#define ADC_BUFFER_SIZE         3
 #define ADC_VREF                3.3f
 #define ADC_MAX_VALUE           4095.0f
 
-// Kalibrasi OP07
+// Kalibrasi OP07 (nominal; koreksi per tip/board lewat tabel adc_calib.h)
 #define OP07_BIAS_VOLTAGE       0.0f
 #define THERMOCOUPLE_GAIN       146.0f
-#define THERMOCOUPLE_UV_PER_C   40.0f
 
-// Kalibrasi NTC
+// Kalibrasi NTC (tabel adc_lut.h dibuat dari nilai ini: tools/gen_adc_lut.py)
 #define NTC_R0                  10000.0f
 #define NTC_BETA                3950.0f
 #define NTC_R_SERIES            10000.0f
 
+// Channel tambahan (butuh rangkaian di board): 1 = ikut scan regular
+#ifndef ADC_SCAN_SUPPLY
+#define ADC_SCAN_SUPPLY         0       // PA3: tegangan PSU lewat pembagi
+#endif
+#ifndef ADC_SCAN_HEATER_CURRENT
+#define ADC_SCAN_HEATER_CURRENT 0       // PA4: amplifier shunt dengan filter RC (arus rata-rata)
+#endif
+#ifndef ADC_SCAN_TIP_ID
+#define ADC_SCAN_TIP_ID         0       // PA5: resistor ID tip ke GND, pull-up ke VREF
+#endif
+#define ADC_SUPPLY_DIVIDER      11.0f   // 100k / 10k
+#define ADC_CURRENT_SHUNT_OHM   0.005f
+#define ADC_CURRENT_GAIN        50.0f
+#define ADC_TIP_ID_PULLUP_OHM   10000.0f
+
+#define ADC_PWM_T12             (1u << PWM_CH_T12_HEATER)
+#define ADC_PWM_HOT_AIR         (1u << PWM_CH_HOT_AIR_HEATER)
+
+// Tabel channel scan regular; urutan = rank ADC = indeks di buffer DMA dan sums[].
+// X(ID, field, channel ADC, pin GPIOA, sample time, decimation, low-pass Hz,
+//   fault min, fault max, fault step, heater yang dimatikan saat fault)
+// Decimation N: hasil channel diterbitkan tiap N blok (rata-rata N blok, low-pass pada
+// laju itu), fault dicek per terbitan. Deteksi stuck hanya untuk channel yang mematikan heater.
+#define ADC_TABLE_BASE(X) \
+    X(T12,     t12,     ADC_CHANNEL_0, GPIO_PIN_0, ADC_SAMPLETIME_55POINT5,  1, ADC_FILTER_LP_HZ_T12, \
+      0, ADC_FAULT_TC_OPEN_CODE, ADC_FAULT_TC_MAX_STEP, ADC_PWM_T12) \
+    X(HOT_AIR, hot_air, ADC_CHANNEL_1, GPIO_PIN_1, ADC_SAMPLETIME_239POINT5, 1, ADC_FILTER_LP_HZ_HOT_AIR, \
+      0, ADC_FAULT_TC_OPEN_CODE, ADC_FAULT_TC_MAX_STEP, ADC_PWM_HOT_AIR) \
+    /* NTC dipakai kompensasi cold junction kedua termokopel */ \
+    X(NTC,     ntc,     ADC_CHANNEL_2, GPIO_PIN_2, ADC_SAMPLETIME_239POINT5, 1, ADC_FILTER_LP_HZ_NTC, \
+      ADC_FAULT_NTC_MIN_CODE, ADC_FAULT_NTC_MAX_CODE, ADC_FAULT_NTC_MAX_STEP, ADC_PWM_T12 | ADC_PWM_HOT_AIR)
+
+#if ADC_SCAN_SUPPLY
+#define ADC_TABLE_SUPPLY(X) \
+    X(SUPPLY,  supply,  ADC_CHANNEL_3, GPIO_PIN_3, ADC_SAMPLETIME_28POINT5,  2, ADC_FILTER_LP_HZ_AUX, \
+      0, 4095, 4095, 0)
+#else
+#define ADC_TABLE_SUPPLY(X)
+#endif
+
+#if ADC_SCAN_HEATER_CURRENT
+#define ADC_TABLE_HEATER_CURRENT(X) \
+    X(HEATER_CURRENT, heater_current, ADC_CHANNEL_4, GPIO_PIN_4, ADC_SAMPLETIME_28POINT5, 2, ADC_FILTER_LP_HZ_AUX, \
+      0, 4095, 4095, 0)
+#else
+#define ADC_TABLE_HEATER_CURRENT(X)
+#endif
 
+#if ADC_SCAN_TIP_ID
+#define ADC_TABLE_TIP_ID(X) \
+    X(TIP_ID,  tip_id,  ADC_CHANNEL_5, GPIO_PIN_5, ADC_SAMPLETIME_239POINT5, 40, 0.0f, \
+      0, 4095, 4095, 0)
+#else
+#define ADC_TABLE_TIP_ID(X)
+#endif
+
+#define ADC_CHANNEL_TABLE(X) \
+    ADC_TABLE_BASE(X) ADC_TABLE_SUPPLY(X) ADC_TABLE_HEATER_CURRENT(X) ADC_TABLE_TIP_ID(X)
+
+// Indeks channel: ADC_CH_T12, ADC_CH_HOT_AIR, ADC_CH_NTC, ...
+#define ADC_CH_ENUM(id, field, ch, pin, smp, dec, lp, fmin, fmax, fstep, pwm) ADC_CH_##id,
+typedef enum {
+    ADC_CHANNEL_TABLE(ADC_CH_ENUM)
+    ADC_CH_COUNT
+} adc_channel_id_t;
+#undef ADC_CH_ENUM
+
+#define ADC_BUFFER_SIZE         ADC_CH_COUNT
 
 // Struktur data sensor
+#define ADC_DATA_RAW(id, field, ch, pin, smp, dec, lp, fmin, fmax, fstep, pwm) uint16_t field##_raw;
+#define ADC_DATA_VOLTAGE(id, field, ch, pin, smp, dec, lp, fmin, fmax, fstep, pwm) float field##_voltage;
 typedef struct {
-    uint16_t t12_raw;
-    uint16_t hot_air_raw;
-    uint16_t ntc_raw;
-    float t12_voltage;
-    float hot_air_voltage;
-    float ntc_voltage;
+    ADC_CHANNEL_TABLE(ADC_DATA_RAW)
+    ADC_CHANNEL_TABLE(ADC_DATA_VOLTAGE)
+#if ADC_SCAN_SUPPLY
+    float supply_v;
+#endif
+#if ADC_SCAN_HEATER_CURRENT
+    float heater_current_a;
+#endif
+#if ADC_SCAN_SUPPLY && ADC_SCAN_HEATER_CURRENT
+    float heater_power_w;       // Daya rata-rata heater (V * I)
+    float heater_load_ohm;      // Beban = V / I (0 jika arus terlalu kecil)
+#endif
+#if ADC_SCAN_TIP_ID
+    float tip_id_ohm;
+#endif
     float t12_temp_c;
     float hot_air_temp_c;
     float ambient_temp_c;
-    uint8_t data_ready;
+    uint8_t data_ready;         // 1 jika panggilan terakhir mendapat blok baru
+    uint32_t seq;               // Nomor blok ADC yang terakhir dibaca
+    uint32_t block_cycles;      // DWT CYCCNT saat blok 'seq' selesai (untuk dt aktual)
 } adc_sensor_t;
+#undef ADC_DATA_RAW
+#undef ADC_DATA_VOLTAGE
+
+// Jenis fault per channel; bit status = ADC_FAULT_BIT(channel, jenis)
+typedef enum {
+    ADC_FAULT_RANGE,            // Di luar rentang (TC putus, NTC short/open)
+    ADC_FAULT_RATE,             // Lompatan tidak masuk akal antar blok
+    ADC_FAULT_STUCK,            // Nilai ADC identik terlalu lama
+    ADC_FAULT_OVERTEMP,         // Analog watchdog hardware (over-temperature)
+    ADC_FAULT_KINDS
+} adc_fault_kind_t;
+
+#define ADC_FAULT_BIT(ch, kind)     (1UL << ((ch) * 4 + (kind)))
+#define ADC_FAULT_CHANNEL_MASK(ch)  (0xFUL << ((ch) * 4))
+#define ADC_FAULT_ALL               0xFFFFFFFFUL
+
+// Hook dari ISR DMA setiap blok ke-N: sums = jumlah ADC_OVERSAMPLE sampel per channel
+typedef void (*adc_block_hook_t)(const uint32_t *sums, uint32_t seq);
 
 // Fungsi API
 void adc_sensor_init(void);
 void adc_sensor_start(void);
 void adc_sensor_stop(void);
+// Posting event ke task setiap 'every_n' blok oversampling selesai (dari ISR DMA_CH0)
+void adc_sensor_notify_task(uint16_t task_id, uint32_t event_mask, uint16_t every_n);
+// Jumlah ADC_OVERSAMPLE sampel terakhir per channel setelah filter (snapshot konsisten).
+// Mengembalikan nomor blok (naik setiap blok selesai), 0 jika belum ada.
+uint32_t adc_sensor_get_sums(uint32_t sums[ADC_BUFFER_SIZE]);
+// Sama, plus DWT CYCCNT saat blok tersebut selesai (selisih dua blok = dt aktual)
+uint32_t adc_sensor_get_sums_stamped(uint32_t sums[ADC_BUFFER_SIZE], uint32_t *block_cycles);
+uint32_t adc_sensor_sequence(void);
+// Jalankan hook langsung di ISR setiap 'every_n' blok (NULL = mati); harus singkat
+void adc_sensor_set_block_hook(adc_block_hook_t hook, uint16_t every_n);
+// Fault: dicek di ISR DMA per blok; fault mematikan heater terkait lewat
+// pwm_timer0_force_off (T12/Hot Air sendiri-sendiri, NTC keduanya) dan di-latch.
+uint32_t adc_sensor_get_fault_status(void);
+uint16_t adc_sensor_get_wdt_threshold(uint8_t channel);    // Kode ADC ambang watchdog
+uint32_t adc_sensor_get_fault_count(uint8_t channel, adc_fault_kind_t kind);
+void adc_sensor_clear_faults(uint32_t mask);
+// Ubah frekuensi potong low-pass satu channel (0 = bypass)
+void adc_sensor_set_lowpass(uint8_t channel, float cutoff_hz);
 // Di adc_sensor.h
+// Mengembalikan 1 hanya jika ada blok baru sejak data->seq (0 = belum ada konversi baru)
 uint8_t adc_sensor_get_data(volatile adc_sensor_t *data);
 
 // Fungsi konversi (publik jika perlu)
 float adc_raw_to_voltage(uint16_t raw);
+float adc_sum_to_voltage(uint32_t sum);     // Jumlah ADC_OVERSAMPLE sampel -> volt
 float adc_compensate_op07_bias(float adc_voltage);
-float adc_calc_ambient_temp(float ntc_voltage);
-float adc_calc_thermocouple_temp(float tc_voltage, float ambient_temp);
+float adc_calc_ambient_temp(float ntc_voltage);                         // Tabel NTC + interpolasi
+float adc_calc_thermocouple_temp(float tc_voltage, float ambient_temp); // Tabel tipe K + cold junction
+// Kode ADC (12-bit) termokopel pada suhu t_c dengan cold junction ambient_temp
+uint16_t adc_tc_temp_to_code(float t_c, float ambient_temp);
+
+// Jalur fixed-point (Q16.16 C) langsung dari jumlah oversampling adc_sensor_get_sums,
+// tanpa float. Selisih terhadap jalur float < 0.01 C. Tanpa koreksi kalibrasi tip:
+// terapkan adc_calib_apply_q16 pada hasilnya.
+q16_t adc_sum_to_ambient_q16(uint32_t ntc_sum);
+q16_t adc_sum_to_tc_temp_q16(uint32_t tc_sum, q16_t ambient);
 // Tambahkan ini di bagian akhir adc_sensor.h, sebelum #endif
 extern volatile adc_sensor_t g_adc_data;
 
@@ -0,0 +1,59 @@
+#include "tip_observer.h"
+#include <math.h>
+
+void tip_observer_init(tip_observer_t *obs, float gain_c, float tau_s, float bandwidth_hz) {
+    obs->gain_c = gain_c;
+    obs->inv_tau = (tau_s > 0.0f) ? 1.0f / tau_s : 0.0f;
+    obs->bandwidth_hz = bandwidth_hz;
+    obs->dt_s = 0.0f;
+    tip_observer_reset(obs, 25.0f);
+    obs->initialized = 0;
+}
+
+void tip_observer_reset(tip_observer_t *obs, float temp_c) {
+    obs->temp_c = temp_c;
+    obs->rate_c_per_s = 0.0f;
+    obs->disturbance = 0.0f;
+    obs->innovation = 0.0f;
+    obs->initialized = 1;
+}
+
+// Kutub ganda r = exp(-2*pi*f*dt): alpha = 1 - r^2, beta = (1 - r)^2 (beta dibagi dt saat koreksi)
+static void tip_observer_gains(tip_observer_t *obs, float dt_s) {
+    if (dt_s == obs->dt_s) return;
+    float r = expf(-2.0f * 3.14159265f * obs->bandwidth_hz * dt_s);
+    obs->alpha = 1.0f - r * r;
+    obs->beta = (1.0f - r) * (1.0f - r);
+    obs->dt_s = dt_s;
+}
+
+void tip_observer_predict(tip_observer_t *obs, float duty_percent, float ambient_c, float dt_s) {
+    if (dt_s <= 0.0f) return;
+    tip_observer_gains(obs, dt_s);
+
+    float model_rate = (obs->gain_c * duty_percent * 0.01f - (obs->temp_c - ambient_c)) * obs->inv_tau;
+    obs->rate_c_per_s = model_rate + obs->disturbance;
+    obs->temp_c += obs->rate_c_per_s * dt_s;
+}
+
+void tip_observer_correct(tip_observer_t *obs, float measured_c) {
+    float e = measured_c - obs->temp_c;
+    obs->innovation = e;
+    obs->temp_c += obs->alpha * e;
+    if (obs->dt_s > 0.0f) {
+        float dd = obs->beta * e / obs->dt_s;
+        obs->disturbance += dd;
+        obs->rate_c_per_s += dd;
+    }
+}
+
+void tip_observer_update(tip_observer_t *obs, float measured_c, float duty_percent,
+                         float ambient_c, float dt_s) {
+    if (!obs->initialized) {
+        tip_observer_reset(obs, measured_c);
+        tip_observer_gains(obs, dt_s);
+        return;
+    }
+    tip_observer_predict(obs, duty_percent, ambient_c, dt_s);
+    tip_observer_correct(obs, measured_c);
+}
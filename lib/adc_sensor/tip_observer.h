@@ -0,0 +1,52 @@
+#ifndef TIP_OBSERVER_H
+#define TIP_OBSERVER_H
+
+#include <stdint.h>
+
+// Observer suhu tip (Luenberger, gain tetap) dengan model termal orde 1:
+//   dT/dt = (gain * duty - (T - T_ambient)) / tau + d
+// d = gangguan yang diestimasi (beban solder, model meleset). Prediksi memakai duty yang
+// benar-benar diterapkan, koreksi memakai bacaan termokopel; hasilnya suhu terfilter dan
+// laju perubahan tanpa beda hingga (tanpa lag filter turunan). Di antara sampel, prediksi
+// saja bisa dipakai (tip_observer_predict) sehingga sampel tidak harus tiap periode kontrol.
+
+#ifndef TIP_OBSERVER_T12_GAIN_C
+#define TIP_OBSERVER_T12_GAIN_C     700.0f  // Kenaikan suhu tunak pada duty 100%
+#endif
+#ifndef TIP_OBSERVER_T12_TAU_S
+#define TIP_OBSERVER_T12_TAU_S      12.0f
+#endif
+#ifndef TIP_OBSERVER_BANDWIDTH_HZ
+#define TIP_OBSERVER_BANDWIDTH_HZ   3.0f    // Kutub ganda observer
+#endif
+
+typedef struct {
+    // Model
+    float gain_c;               // C pada duty 100%
+    float inv_tau;              // 1/s
+    float bandwidth_hz;
+
+    // Estimasi
+    float temp_c;
+    float rate_c_per_s;         // dT/dt termasuk gangguan
+    float disturbance;          // C/s
+    float innovation;           // Bacaan - prediksi terakhir (C)
+
+    // Gain untuk dt terakhir (dihitung ulang hanya jika dt berubah)
+    float dt_s;
+    float alpha;
+    float beta;
+    uint8_t initialized;
+} tip_observer_t;
+
+void tip_observer_init(tip_observer_t *obs, float gain_c, float tau_s, float bandwidth_hz);
+void tip_observer_reset(tip_observer_t *obs, float temp_c);
+// Maju dt detik dengan duty (%) yang diterapkan selama interval itu, tanpa sampel
+void tip_observer_predict(tip_observer_t *obs, float duty_percent, float ambient_c, float dt_s);
+// Koreksi dengan bacaan termokopel (setelah predict untuk interval yang sama)
+void tip_observer_correct(tip_observer_t *obs, float measured_c);
+// predict + correct; sampel pertama menginisialisasi state
+void tip_observer_update(tip_observer_t *obs, float measured_c, float duty_percent,
+                         float ambient_c, float dt_s);
+
+#endif
@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+# Generator tabel konversi adc_lut.h (NTC dan termokopel tipe K).
+#
+#   python3 gen_adc_lut.py            tulis ulang ../adc_lut.h
+#   python3 gen_adc_lut.py --check    bandingkan tabel vs rumus asli, gagal jika
+#                                     header usang atau error interpolasi > batas
+#
+# Parameter NTC (NTC_R0, NTC_BETA, NTC_R_SERIES) dibaca dari adc_sensor.h.
+# Bisa juga dipasang sebagai extra_scripts "pre:" PlatformIO: header dibuat ulang
+# otomatis sebelum build jika parameter berubah.
+
+import math
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821 (hanya ada di dalam SCons/PlatformIO)
+    HERE = os.path.join(env.subst("$PROJECT_DIR"), "lib", "adc_sensor", "tools")  # noqa: F821
+    IN_SCONS = True
+except NameError:
+    HERE = os.path.dirname(os.path.abspath(__file__))
+    IN_SCONS = False
+
+LIB_DIR = os.path.dirname(HERE)
+HEADER_IN = os.path.join(LIB_DIR, "adc_sensor.h")
+HEADER_OUT = os.path.join(LIB_DIR, "adc_lut.h")
+
+# --- Ukuran tabel ---
+NTC_SEGMENTS = 64           # Rasio ADC 0..1 dibagi 64 segmen (65 titik)
+NTC_T_MIN = -40.0           # Klem ujung tabel (rel ADC ditangani di C)
+NTC_T_MAX = 150.0
+
+TC_CJ_T_MIN = -20           # Tabel emf(T) untuk kompensasi cold junction
+TC_CJ_T_STEP = 5
+TC_CJ_POINTS = 21           # -20..80 C
+
+TC_EMF_STEP_UV = 500        # Tabel T(emf) invers, 0..25000 uV (~0..602 C)
+TC_EMF_POINTS = 51
+
+# Batas error interpolasi untuk --check (C)
+NTC_MAX_ERR = 0.2           # Di rentang 0..70 C
+TC_MAX_ERR = 0.1            # Di rentang 0..500 C
+
+
+def read_params():
+    text = open(HEADER_IN, encoding="utf-8").read()
+    params = {}
+    for name in ("NTC_R0", "NTC_BETA", "NTC_R_SERIES"):
+        m = re.search(r"#define\s+%s\s+([0-9.eE+-]+)f?" % name, text)
+        if not m:
+            sys.exit("gen_adc_lut: %s tidak ditemukan di adc_sensor.h" % name)
+        params[name] = float(m.group(1))
+    return params
+
+
+# --- Rumus tertutup ---
+def ntc_temp(ratio, p):
+    r = p["NTC_R_SERIES"] * ratio / (1.0 - ratio)
+    return 1.0 / (1.0 / 298.15 + math.log(r / p["NTC_R0"]) / p["NTC_BETA"]) - 273.15
+
+
+# NIST ITS-90 tipe K, emf dalam mV
+K_NEG = [0.0, 0.394501280250e-01, 0.236223735980e-04, -0.328589067840e-06,
+         -0.499048287770e-08, -0.675090591730e-10, -0.574103274280e-12,
+         -0.310888728940e-14, -0.104516093650e-16, -0.198892668780e-19,
+         -0.163226974860e-22]
+K_POS = [-0.176004136860e-01, 0.389212049750e-01, 0.185587700320e-04,
+         -0.994575928740e-07, 0.318409457190e-09, -0.560728448890e-12,
+         0.560750590590e-15, -0.320207200030e-18, 0.971511471520e-22,
+         -0.121047212750e-25]
+K_A = (0.118597600000e+00, -0.118343200000e-03, 0.126968600000e+03)
+
+
+def tc_k_emf_uv(t):
+    coeffs = K_NEG if t < 0.0 else K_POS
+    mv = sum(c * t ** i for i, c in enumerate(coeffs))
+    if t >= 0.0:
+        mv += K_A[0] * math.exp(K_A[1] * (t - K_A[2]) ** 2)
+    return mv * 1000.0
+
+
+def tc_k_temp(uv):
+    lo, hi = -270.0, 1372.0
+    for _ in range(80):
+        mid = 0.5 * (lo + hi)
+        if tc_k_emf_uv(mid) < uv:
+            lo = mid
+        else:
+            hi = mid
+    return 0.5 * (lo + hi)
+
+
+# --- Tabel ---
+def build_tables(p):
+    ntc = []
+    for i in range(NTC_SEGMENTS + 1):
+        ratio = i / NTC_SEGMENTS
+        if ratio <= 0.0:
+            t = NTC_T_MAX
+        elif ratio >= 1.0:
+            t = NTC_T_MIN
+        else:
+            t = min(max(ntc_temp(ratio, p), NTC_T_MIN), NTC_T_MAX)
+        ntc.append(t)
+    cj = [tc_k_emf_uv(TC_CJ_T_MIN + i * TC_CJ_T_STEP) for i in range(TC_CJ_POINTS)]
+    tc = [tc_k_temp(i * TC_EMF_STEP_UV) for i in range(TC_EMF_POINTS)]
+    return ntc, cj, tc
+
+
+def fmt_array(name, values, per_line=6):
+    lines = ["static const float %s[%d] = {" % (name, len(values))]
+    for i in range(0, len(values), per_line):
+        chunk = ", ".join("%.3ff" % v for v in values[i:i + per_line])
+        lines.append("    " + chunk + ",")
+    lines[-1] = lines[-1].rstrip(",")
+    lines.append("};")
+    return lines
+
+
+# Versi Q16.16 (int32) untuk jalur fixed-point
+def q16(v):
+    return int(math.floor(v * 65536.0 + 0.5))
+
+
+def fmt_array_q16(name, values, per_line=6):
+    lines = ["static const int32_t %s[%d] = {" % (name, len(values))]
+    for i in range(0, len(values), per_line):
+        chunk = ", ".join("%d" % q16(v) for v in values[i:i + per_line])
+        lines.append("    " + chunk + ",")
+    lines[-1] = lines[-1].rstrip(",")
+    lines.append("};")
+    return lines
+
+
+def render(p):
+    ntc, cj, tc = build_tables(p)
+    out = [
+        "#ifndef ADC_LUT_H",
+        "#define ADC_LUT_H",
+        "",
+        "// DIBUAT OTOMATIS oleh tools/gen_adc_lut.py - jangan diedit manual.",
+        "// NTC_R0=%g NTC_BETA=%g NTC_R_SERIES=%g" % (p["NTC_R0"], p["NTC_BETA"], p["NTC_R_SERIES"]),
+        "",
+        "#include <stdint.h>",
+        "",
+        "#define ADC_LUT_NTC_R0          %.1ff" % p["NTC_R0"],
+        "#define ADC_LUT_NTC_BETA        %.1ff" % p["NTC_BETA"],
+        "#define ADC_LUT_NTC_R_SERIES    %.1ff" % p["NTC_R_SERIES"],
+        "",
+        "// Suhu NTC (C) per rasio tegangan v/VREF, %d segmen seragam" % NTC_SEGMENTS,
+        "#define ADC_LUT_NTC_SEGMENTS    %d" % NTC_SEGMENTS,
+    ]
+    out += fmt_array("adc_lut_ntc_temp_c", ntc)
+    out += [
+        "",
+        "// Termokopel tipe K (NIST ITS-90): emf (uV) per suhu, untuk cold junction",
+        "#define ADC_LUT_CJ_T_MIN        (%.1ff)" % TC_CJ_T_MIN,
+        "#define ADC_LUT_CJ_T_STEP       %.1ff" % TC_CJ_T_STEP,
+        "#define ADC_LUT_CJ_POINTS       %d" % TC_CJ_POINTS,
+    ]
+    out += fmt_array("adc_lut_tc_emf_uv", cj)
+    out += [
+        "",
+        "// Termokopel tipe K: suhu (C) per emf, langkah seragam",
+        "#define ADC_LUT_TC_EMF_STEP_UV  %.1ff" % TC_EMF_STEP_UV,
+        "#define ADC_LUT_TC_POINTS       %d" % TC_EMF_POINTS,
+    ]
+    out += fmt_array("adc_lut_tc_temp_c", tc)
+    out += [
+        "",
+        "// Q16.16: suhu (C) dan emf cold junction sebagai posisi di adc_lut_tc_temp_q16",
+    ]
+    out += fmt_array_q16("adc_lut_ntc_temp_q16", ntc)
+    out += fmt_array_q16("adc_lut_tc_cj_pos_q16", [v / TC_EMF_STEP_UV for v in cj])
+    out += fmt_array_q16("adc_lut_tc_temp_q16", tc)
+    out += ["", "#endif"]
+    return "\r\n".join(out)
+
+
+# --- Pemeriksaan (meniru interpolasi di adc_convert.c) ---
+def interp(table, x):
+    n = len(table) - 1
+    i = min(max(int(math.floor(x)), 0), n - 1)
+    return table[i] + (table[i + 1] - table[i]) * (x - i)
+
+
+def check(p):
+    ntc, cj, tc = build_tables(p)
+    ok = True
+
+    err = 0.0
+    for k in range(1, 4095):
+        ratio = k / 4095.0
+        exact = ntc_temp(ratio, p)
+        if 0.0 <= exact <= 70.0:
+            err = max(err, abs(interp(ntc, ratio * NTC_SEGMENTS) - exact))
+    print("NTC     0..70 C : error maks %.3f C (batas %.2f)" % (err, NTC_MAX_ERR))
+    ok &= err <= NTC_MAX_ERR
+
+    err = 0.0
+    for t10 in range(TC_CJ_T_MIN * 10, (TC_CJ_T_MIN + (TC_CJ_POINTS - 1) * TC_CJ_T_STEP) * 10):
+        t = t10 / 10.0
+        exact = tc_k_emf_uv(t)
+        got = interp(cj, (t - TC_CJ_T_MIN) / TC_CJ_T_STEP)
+        err = max(err, abs(got - exact) / 40.0)
+    print("TC CJ  -20..80 C: error maks %.3f C" % err)
+    ok &= err <= TC_MAX_ERR
+
+    err = 0.0
+    for t10 in range(0, 5001):
+        t = t10 / 10.0
+        got = interp(tc, tc_k_emf_uv(t) / TC_EMF_STEP_UV)
+        err = max(err, abs(got - t))
+    print("TC     0..500 C : error maks %.3f C (batas %.2f)" % (err, TC_MAX_ERR))
+    ok &= err <= TC_MAX_ERR
+
+    current = open(HEADER_OUT, encoding="utf-8", newline="").read() if os.path.exists(HEADER_OUT) else ""
+    if current != render(p):
+        print("adc_lut.h usang: jalankan gen_adc_lut.py")
+        ok = False
+    return ok
+
+
+def write(p):
+    text = render(p)
+    if os.path.exists(HEADER_OUT) and open(HEADER_OUT, encoding="utf-8", newline="").read() == text:
+        return
+    with open(HEADER_OUT, "w", encoding="utf-8", newline="") as f:
+        f.write(text)
+    print("gen_adc_lut: adc_lut.h diperbarui")
+
+
+if IN_SCONS:
+    write(read_params())
+elif __name__ == "__main__":
+    params = read_params()
+    if "--check" in sys.argv[1:]:
+        sys.exit(0 if check(params) else 1)
+    write(params)
@@ -1,9 +1,61 @@
 #include "delay.h"
 #include <stdint.h>
 #include <stddef.h>
+#include <stdio.h>
+#include <string.h>
 
-#define MAX_TASK 16
 #define INVALID_TASK_ID 0xFFFF
+#define TIMER_HEAP_NONE 0xFFFF
+
+#if (TASK_READY_RING_SIZE & (TASK_READY_RING_SIZE - 1)) != 0 || TASK_READY_RING_SIZE < MAX_TASK
+#error "TASK_READY_RING_SIZE harus pangkat dua dan >= MAX_TASK"
+#endif
+#define READY_RING_MASK (TASK_READY_RING_SIZE - 1)
+
+#if (TASK_ID_MAP_SIZE & (TASK_ID_MAP_SIZE - 1)) != 0 || TASK_ID_MAP_SIZE < MAX_TASK || MAX_TASK > 255
+#error "TASK_ID_MAP_SIZE harus pangkat dua dan >= MAX_TASK (MAX_TASK <= 255)"
+#endif
+#define ID_MAP_MASK (TASK_ID_MAP_SIZE - 1)
+#define ID_MAP_NONE 0xFF
+
+// Perbandingan waktu yang aman terhadap overflow systick_millis
+#define TIME_REACHED(now, deadline) ((int32_t)((now) - (deadline)) >= 0)
+#define TIME_BEFORE(a, b)           ((int32_t)((a) - (b)) < 0)
+
+// Hook timeline (diisi port simulasi host, kosong di target)
+#ifndef DELAY_TRACE_RELEASE
+#define DELAY_TRACE_RELEASE(task)
+#endif
+#ifndef DELAY_TRACE_START
+#define DELAY_TRACE_START(task)
+#endif
+#ifndef DELAY_TRACE_END
+#define DELAY_TRACE_END(task_id, priority)
+#endif
+#ifndef DELAY_TRACE_STATIC_RELEASE
+#define DELAY_TRACE_STATIC_RELEASE(task_id, priority)
+#endif
+#ifndef DELAY_TRACE_STATIC_START
+#define DELAY_TRACE_STATIC_START(task_id, priority)
+#endif
+
+// Akses SysTick tickless idle (port simulasi host mengemulasikan efek tulisnya).
+// Stop ditulis langsung: read-modify-write akan meng-clear COUNTFLAG.
+#ifndef DELAY_SYSTICK_STOP
+#define DELAY_SYSTICK_STOP()        (SysTick->CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk)
+#endif
+#ifndef DELAY_SYSTICK_RESUME
+#define DELAY_SYSTICK_RESUME()      (SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk)
+#endif
+// Counter di-reset lalu menghitung 'load' + 1 siklus sampai tick berikutnya
+#ifndef DELAY_SYSTICK_RESTART
+#define DELAY_SYSTICK_RESTART(load)                                 \
+    do {                                                            \
+        SysTick->LOAD = (load);                                     \
+        SysTick->VAL = 0;                                           \
+        SysTick->CTRL |= SysTick_CTRL_ENABLE_Msk;                   \
+    } while (0)
+#endif
 
 // --- Global Variables ---
 static task_t _tasks[MAX_TASK] = {0};
@@ -12,6 +64,50 @@ static volatile uint32_t systick_millis = 0;
 static bool systick_initialized = false;
 static uint16_t next_task_id = 1;
 
+// Bucket (ID & ID_MAP_MASK) -> slot di _tasks[], ID_MAP_NONE = kosong. task_alloc_id
+// melompati ID yang bucket-nya dipakai task hidup, jadi find_task_by_id cukup satu
+// baca (dipanggil task_post_event dari ISR).
+static uint8_t _id_slot[TASK_ID_MAP_SIZE];
+
+// Min-heap berdasarkan deadline_ms: elemen [0] selalu task yang paling dekat jatuh tempo.
+// SysTick_Handler cukup membandingkan elemen teratas (O(1)) dan hanya menyentuh task
+// yang jatuh tempo (O(log n) per task).
+static task_t *_timer_heap[MAX_TASK];
+static volatile uint16_t _timer_heap_count = 0;
+
+static volatile systick_isr_stats_t _isr_stats = {0};
+static task_t *_current_task = NULL;
+static uint32_t _drain_budget_cycles = TASK_DRAIN_BUDGET_CYCLES;
+static task_drain_stats_t _drain_stats = {0};
+
+static uint32_t _systick_ticks_per_ms = 0;
+static bool _tickless_enabled = (DELAY_TICKLESS_ENABLE != 0);
+static tickless_stats_t _tickless_stats = {0};
+
+// Bit per slot: task yang menerima event dan perlu dicek consumer
+static volatile uint32_t _event_ready[(MAX_TASK + 31) / 32];
+
+// Tabel task statis: definisi dibaca dari flash, state runtime di RAM milik aplikasi.
+// Bit i di bitmap = entri ke-i.
+static const task_def_t *_static_defs = NULL;
+static task_static_t *_static_tasks = NULL;
+static uint8_t _static_count = 0;
+static const uint32_t *_static_prio_mask = NULL;    // Entri per prioritas, konstanta dari TASK_TABLE_DEFINE
+static volatile uint32_t _static_active = 0;    // Tidak suspend; ditulis thread di critical section
+static volatile uint32_t _static_ready = 0;     // Di-set SysTick, di-clear thread di critical section
+static volatile uint32_t _static_next_ms = 0;   // Deadline terdekat task statis aktif
+static int8_t _static_current = -1;             // Entri yang sedang berjalan
+
+// Di host pointer 64-bit membuat task_t lebih besar, budget hanya berlaku untuk target
+#ifndef DELAY_HOST_SIM
+_Static_assert(sizeof(_tasks) + sizeof(_task_queues) + sizeof(_timer_heap) + sizeof(_event_ready)
+               + sizeof(_id_slot) <= DELAY_RAM_BUDGET, "RAM scheduler melebihi DELAY_RAM_BUDGET, kurangi MAX_TASK");
+#endif
+
+#if TASK_PROFILER_ENABLE
+static void (*_stats_print)(const char *line) = NULL;
+#endif
+
 // --- DWT Functions (GD32 compatible) ---
 static void dwt_init(void) {
     // Aktifkan trace & DWT
@@ -30,45 +126,434 @@ static void delay_us_dwt(uint32_t us) {
 
     uint32_t start = dwt_get_cycle();
     while ((dwt_get_cycle() - start) < ticks) {
-        __asm__("nop");
+        __NOP();
+    }
+}
+
+// --- Critical Section ---
+static inline uint32_t critical_enter(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static inline void critical_exit(uint32_t primask) {
+    __set_PRIMASK(primask);
+}
+
+// --- Atomik (LDREX/STREX, aman terhadap ISR dengan prioritas apa pun) ---
+static inline void atomic_or_u32(volatile uint32_t *p, uint32_t bits) {
+    uint32_t value;
+    do {
+        value = __LDREXW(p) | bits;
+    } while (__STREXW(value, p) != 0);
+}
+
+// Ambil dan clear bit 'mask', kembalikan bit yang tadinya set
+static inline uint32_t atomic_take_u32(volatile uint32_t *p, uint32_t mask) {
+    uint32_t value;
+    do {
+        value = __LDREXW(p);
+    } while (__STREXW(value & ~mask, p) != 0);
+    return value & mask;
+}
+
+// --- Timer Heap (dipanggil dari ISR, atau dari thread di dalam critical section) ---
+static inline void timer_heap_place(uint16_t index, task_t *task) {
+    _timer_heap[index] = task;
+    task->heap_index = index;
+}
+
+static void timer_heap_sift_up(uint16_t index) {
+    task_t *task = _timer_heap[index];
+    while (index > 0) {
+        uint16_t parent = (index - 1) / 2;
+        if (!TIME_BEFORE(task->deadline_ms, _timer_heap[parent]->deadline_ms)) {
+            break;
+        }
+        timer_heap_place(index, _timer_heap[parent]);
+        index = parent;
+    }
+    timer_heap_place(index, task);
+}
+
+static void timer_heap_sift_down(uint16_t index) {
+    uint16_t count = _timer_heap_count;
+    task_t *task = _timer_heap[index];
+    for (;;) {
+        uint16_t child = 2 * index + 1;
+        if (child >= count) {
+            break;
+        }
+        if (child + 1 < count &&
+            TIME_BEFORE(_timer_heap[child + 1]->deadline_ms, _timer_heap[child]->deadline_ms)) {
+            child++;
+        }
+        if (!TIME_BEFORE(_timer_heap[child]->deadline_ms, task->deadline_ms)) {
+            break;
+        }
+        timer_heap_place(index, _timer_heap[child]);
+        index = child;
+    }
+    timer_heap_place(index, task);
+}
+
+static void timer_heap_push(task_t *task) {
+    if (task->heap_index != TIMER_HEAP_NONE || _timer_heap_count >= MAX_TASK) {
+        return;
+    }
+    uint16_t index = _timer_heap_count++;
+    timer_heap_place(index, task);
+    timer_heap_sift_up(index);
+}
+
+static void timer_heap_remove(task_t *task) {
+    uint16_t index = task->heap_index;
+    if (index == TIMER_HEAP_NONE) {
+        return;
+    }
+    task->heap_index = TIMER_HEAP_NONE;
+
+    uint16_t last = --_timer_heap_count;
+    if (index == last) {
+        return;
+    }
+    // Pindahkan elemen terakhir ke posisi yang kosong lalu perbaiki urutannya
+    timer_heap_place(index, _timer_heap[last]);
+    if (index > 0 &&
+        TIME_BEFORE(_timer_heap[index]->deadline_ms, _timer_heap[(index - 1) / 2]->deadline_ms)) {
+        timer_heap_sift_up(index);
+    } else {
+        timer_heap_sift_down(index);
+    }
+}
+
+// Pasang task ke timer heap dengan deadline now + delay (thread context)
+static void task_arm_delay(task_t *task, uint32_t delay_ms) {
+    uint32_t primask = critical_enter();
+    timer_heap_remove(task);
+    task->deadline_ms = systick_millis + delay_ms;
+    if (delay_ms > 0) {
+        timer_heap_push(task);
+    }
+    critical_exit(primask);
+}
+
+static void task_arm(task_t *task) {
+    task_arm_delay(task, task->interval_ms);
+}
+
+static void task_disarm(task_t *task) {
+    uint32_t primask = critical_enter();
+    timer_heap_remove(task);
+    critical_exit(primask);
+}
+
+// Deadline absolut: jadwal tidak bergeser walaupun rilis/eksekusi terlambat. Jika masih
+// terlewat lebih dari satu periode (IRQ lama dimatikan), lompati ke fase berikutnya.
+// Mengembalikan jumlah aktivasi yang dilompati.
+static inline uint32_t deadline_advance(uint32_t *deadline_ms, uint32_t interval_ms, uint32_t now) {
+    uint32_t late = 0;
+    *deadline_ms += interval_ms;
+    if (TIME_REACHED(now, *deadline_ms)) {
+        late = (now - *deadline_ms) / interval_ms + 1;
+        *deadline_ms += late * interval_ms;
+    }
+    return late;
+}
+
+// Rilis task statis yang jatuh tempo dan cari deadline terdekat berikutnya. Hanya
+// dipanggil pada tick yang merilis task statis (ISR).
+static uint32_t task_static_release(uint32_t now) {
+    uint32_t active = _static_active;
+    uint32_t released = 0;
+    uint32_t next = now + 0x7FFFFFFFUL;
+
+    for (uint8_t i = 0; i < _static_count; i++) {
+        uint32_t bit = 1UL << i;
+        if ((active & bit) == 0) {
+            continue;
+        }
+        task_static_t *st = &_static_tasks[i];
+        if (TIME_REACHED(now, st->deadline_ms)) {
+            uint32_t missed = 0;
+            if (_static_ready & bit) {
+                missed = 1;     // Rilis sebelumnya belum dijalankan
+            } else {
+                st->release_ms = now;
+                _static_ready |= bit;
+                DELAY_TRACE_STATIC_RELEASE(TASK_STATIC_ID(i), _static_defs[i].priority);
+                released++;
+            }
+            missed += deadline_advance(&st->deadline_ms, _static_defs[i].interval_ms, now);
+            if (missed > 0) {
+                st->overruns += missed;
+            }
+        }
+        if (TIME_BEFORE(st->deadline_ms, next)) {
+            next = st->deadline_ms;
+        }
     }
+    _static_next_ms = next;
+    return released;
 }
 
 // --- SysTick Handler ---
 void SysTick_Handler(void) {
-    systick_millis++;
+    uint32_t start_cycles = dwt_get_cycle();
+    uint32_t current_time = ++systick_millis;
+    uint32_t released = 0;
 
-    uint32_t current_time = systick_millis;
-    for (int i = 0; i < MAX_TASK; i++) {
-        if (_tasks[i].state == TASK_RUNNING) {
-            if (_tasks[i].counter_ms > 0) {
-                _tasks[i].counter_ms--;
-                if (_tasks[i].counter_ms == 0) {
-                    if (task_queue_add(&_tasks[i])) {
-                        _tasks[i].last_run_ms = current_time;
-                        if (_tasks[i].oneshot) {
-                            _tasks[i].state = TASK_STOPPED;
-                        } else {
-                            _tasks[i].counter_ms = _tasks[i].interval_ms;
-                        }
-                    }
-                }
+    // Hanya task yang jatuh tempo yang disentuh; tanpa rilis biayanya O(1)
+    while (_timer_heap_count > 0 && TIME_REACHED(current_time, _timer_heap[0]->deadline_ms)) {
+        task_t *task = _timer_heap[0];
+
+        bool was_queued = task->queued;
+        bool added = task_queue_add(task);
+        bool periodic = !(task->oneshot || task->type == TASK_TYPE_COROUTINE ||
+                          task->type == TASK_TYPE_EVENT);
+
+        if (added) {
+            // Sudah di ring (rilis sebelumnya belum dijalankan): bukan rilis baru
+            if (!was_queued) {
+                released++;
+                task->last_run_ms = current_time;
+            }
+            if (!periodic) {
+                // Oneshot: STOPPED di-set consumer saat dijalankan.
+                // Coroutine/event: dipasang ulang oleh consumer setelah dijalankan.
+                timer_heap_remove(task);
+                continue;
             }
+        } else if (!periodic) {
+            // Ring penuh: task tetap di heap dan dicoba lagi tick berikutnya
+            task->overruns++;
+            task->deadline_ms = current_time + 1;
+            timer_heap_sift_down(0);
+            continue;
+        }
+
+        // Rilis yang gagal karena ring penuh dihitung overrun, task tetap terjadwal
+        uint32_t missed = (was_queued || !added) ? 1 : 0;
+        missed += deadline_advance(&task->deadline_ms, task->interval_ms, current_time);
+        if (missed > 0) {
+            task->overruns += missed;
         }
+        timer_heap_sift_down(0);
+    }
+
+    if (_static_active != 0 && TIME_REACHED(current_time, _static_next_ms)) {
+        released += task_static_release(current_time);
+    }
+
+    uint32_t cycles = dwt_get_cycle() - start_cycles;
+    _isr_stats.ticks++;
+    _isr_stats.releases += released;
+    _isr_stats.last_cycles = cycles;
+    if (cycles > _isr_stats.max_cycles) {
+        _isr_stats.max_cycles = cycles;
+    }
+    if (released == 0 && cycles > _isr_stats.max_idle_cycles) {
+        _isr_stats.max_idle_cycles = cycles;
     }
 }
 
+void delay_get_isr_stats(systick_isr_stats_t *stats) {
+    if (stats == NULL) return;
+
+    uint32_t primask = critical_enter();
+    stats->ticks = _isr_stats.ticks;
+    stats->releases = _isr_stats.releases;
+    stats->last_cycles = _isr_stats.last_cycles;
+    stats->max_cycles = _isr_stats.max_cycles;
+    stats->max_idle_cycles = _isr_stats.max_idle_cycles;
+    critical_exit(primask);
+}
+
+void delay_reset_isr_stats(void) {
+    uint32_t primask = critical_enter();
+    _isr_stats.ticks = 0;
+    _isr_stats.releases = 0;
+    _isr_stats.last_cycles = 0;
+    _isr_stats.max_cycles = 0;
+    _isr_stats.max_idle_cycles = 0;
+    critical_exit(primask);
+}
+
 // --- SysTick Init (GD32) ---
 static void systick_init(void) {
     uint32_t ahb_freq = rcu_clock_freq_get(CK_AHB);
     // Reload value for 1ms (SysTick uses AHB/8 by default on GD32 unless changed)
     // But GD32F350 SysTick uses AHB clock directly if bit STK_CTL.CLKSOURCE = 1
     SysTick_Config(ahb_freq / 1000); // This sets reload, enables, and sets source = AHB
+    _systick_ticks_per_ms = ahb_freq / 1000;
 
     systick_millis = 0;
     systick_initialized = true;
 }
 
+// --- Tickless Idle ---
+// Saat tidak ada task siap, reload SysTick diperpanjang sampai deadline terdekat di
+// timer heap sehingga core tidur tanpa dibangunkan setiap 1 ms. Setelah bangun,
+// systick_millis dikoreksi dengan jumlah tick yang terlewati. systick_millis hanya
+// pernah bertambah, jadi get_millis() tetap monoton.
+// Catatan: deep sleep menghentikan HCLK (dan SysTick), jadi yang dipakai di sini adalah
+// mode sleep biasa.
+static bool ready_queue_pending(void) {
+    if (_static_ready != 0) {
+        return true;
+    }
+    for (int i = 0; i < TASK_PRIORITY_COUNT; i++) {
+        if (_task_queues[i].head != _task_queues[i].tail || _task_queues[i].backlog_head != NULL) {
+            return true;
+        }
+    }
+    for (int i = 0; i < (MAX_TASK + 31) / 32; i++) {
+        if (_event_ready[i] != 0) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// idle: kembali tanpa tidur jika ada task siap (dari main loop). Dari delay_ms task
+// siap tidak bisa dijalankan, jadi cukup tidur sampai interupsi berikutnya.
+static void tickless_sleep_until(uint32_t wake_ms, bool idle) {
+    uint32_t primask = critical_enter();
+
+    bool ready = ready_queue_pending();
+    if (idle && ready) {
+        critical_exit(primask);
+        return;
+    }
+
+    uint32_t now = systick_millis;
+    uint32_t target = wake_ms;
+    if (_timer_heap_count > 0 && TIME_BEFORE(_timer_heap[0]->deadline_ms, target)) {
+        target = _timer_heap[0]->deadline_ms;
+    }
+    if (_static_active != 0 && TIME_BEFORE(_static_next_ms, target)) {
+        target = _static_next_ms;
+    }
+    int32_t idle_ms = (int32_t)(target - now);
+
+    uint32_t period = _systick_ticks_per_ms;
+    uint32_t max_ms = (period > 0) ? (SysTick_LOAD_RELOAD_Msk / period) : 0;
+    if (idle_ms > (int32_t)max_ms) {
+        idle_ms = (int32_t)max_ms;
+    }
+
+    // WFI dengan PRIMASK aktif tetap bangun oleh interupsi yang pending,
+    // handler-nya baru dijalankan setelah critical_exit.
+    if (!_tickless_enabled || idle_ms < DELAY_TICKLESS_MIN_IDLE_MS || ready) {
+        __WFI();
+        critical_exit(primask);
+        return;
+    }
+
+    // Hentikan SysTick; batalkan jika tick sudah pending selama perhitungan di atas
+    DELAY_SYSTICK_STOP();
+    if (SCB->ICSR & SCB_ICSR_PENDSTSET_Msk) {
+        DELAY_SYSTICK_RESUME();
+        critical_exit(primask);
+        return;
+    }
+
+    // Sisa tick sekarang + (idle_ms - 1) tick penuh
+    uint32_t remaining = SysTick->VAL;
+    if (remaining == 0) {
+        remaining = period;
+    }
+    uint32_t sleep_load = remaining + (uint32_t)(idle_ms - 1) * period - 1;
+    DELAY_SYSTICK_RESTART(sleep_load);
+
+    __DSB();
+    __WFI();
+    __ISB();
+
+    DELAY_SYSTICK_STOP();
+    uint32_t ctrl = SysTick->CTRL;
+    uint32_t val = SysTick->VAL;
+    uint32_t next_load;
+
+    if (ctrl & SysTick_CTRL_COUNTFLAG_Msk) {
+        // Tidur penuh: tick terakhir ditambahkan oleh SysTick_Handler yang pending
+        systick_millis += (uint32_t)(idle_ms - 1);
+        _tickless_stats.slept_ms += (uint32_t)(idle_ms - 1);
+
+        // Counter sudah reload ke sleep_load (satu siklus setelah wrap); kompensasi
+        // waktu sejak wrap
+        uint32_t since_wrap = (val > 0) ? (sleep_load + 1 - val) : 0;
+        next_load = (since_wrap < period - 1) ? (period - 1 - since_wrap) : (period - 1);
+    } else {
+        // Dibangunkan interupsi lain: hitung tick penuh yang sudah lewat. Setelah
+        // tulis VAL counter butuh satu siklus untuk memuat sleep_load.
+        uint32_t elapsed = sleep_load + 1 - val;
+        uint32_t ticks = 0;
+        uint32_t to_boundary = remaining - elapsed;
+        if (elapsed >= remaining) {
+            uint32_t past = elapsed - remaining;
+            ticks = 1 + past / period;
+            to_boundary = period - (past % period);
+        }
+        systick_millis += ticks;
+        _tickless_stats.slept_ms += ticks;
+        _tickless_stats.early_wakeups++;
+        next_load = (to_boundary > 0) ? (to_boundary - 1) : (period - 1);
+    }
+
+    // Selesaikan tick yang sedang berjalan lalu kembali ke periode 1 ms
+    DELAY_SYSTICK_RESTART(next_load);
+    SysTick->LOAD = period - 1;
+
+    _tickless_stats.sleeps++;
+    critical_exit(primask);
+}
+
+void task_scheduler_idle(void) {
+    tickless_sleep_until(systick_millis + SysTick_LOAD_RELOAD_Msk, true);
+}
+
+void delay_set_tickless(bool enable) {
+    _tickless_enabled = enable;
+}
+
+void delay_get_tickless_stats(tickless_stats_t *stats) {
+    if (stats == NULL) return;
+
+    uint32_t primask = critical_enter();
+    *stats = _tickless_stats;
+    critical_exit(primask);
+}
+
+// --- Task Runtime State ---
+static void task_overrun_clear(task_t *task) {
+    task->overrun_policy = TASK_OVERRUN_SKIP;
+    task->overruns = 0;
+    task->overruns_seen = 0;
+    task->caught_up = 0;
+    task->prev_release_ms = task->last_run_ms;
+    task->period_ms = task->interval_ms;
+    task->activations = 1;
+    task->backlog_run = false;
+}
+
+static void task_event_clear(task_t *task) {
+    task->events_pending = 0;
+    task->event_mask = 0;
+    task->events = 0;
+}
+
+static void task_stats_clear(task_t *task) {
+#if TASK_PROFILER_ENABLE
+    task->name = NULL;
+    memset(&task->stats, 0, sizeof(task->stats));
+    task->stats.cycles_min = UINT32_MAX;
+#else
+    (void)task;
+#endif
+}
+
 // --- System Init ---
 void delay_init(void) {
     // Pastikan clock system sudah diinisialisasi
@@ -82,21 +567,37 @@ void delay_init(void) {
 
     // Inisialisasi antrian tugas
     task_queue_init();
+    _timer_heap_count = 0;
 
     for (int i = 0; i < MAX_TASK; i++) {
         _tasks[i].state = TASK_STOPPED;
         _tasks[i].cb = NULL;
+        _tasks[i].co = NULL;
+        _tasks[i].co_line = 0;
         _tasks[i].semaphore = NULL;
         _tasks[i].interval_ms = 0;
-        _tasks[i].counter_ms = 0;
+        _tasks[i].deadline_ms = 0;
         _tasks[i].last_run_ms = 0;
         _tasks[i].type = TASK_TYPE_CALLBACK;
         _tasks[i].oneshot = false;
+        _tasks[i].queued = false;
         _tasks[i].priority = TASK_PRIORITY_NORMAL;
         _tasks[i].task_id = INVALID_TASK_ID;
+        _tasks[i].heap_index = TIMER_HEAP_NONE;
         _tasks[i].next = NULL;
+        _tasks[i].backlog_queued = false;
+        task_overrun_clear(&_tasks[i]);
+        task_event_clear(&_tasks[i]);
+    }
+    for (int i = 0; i < (MAX_TASK + 31) / 32; i++) {
+        _event_ready[i] = 0;
     }
+    memset(_id_slot, ID_MAP_NONE, sizeof(_id_slot));
 
+    _static_count = 0;
+    _static_active = 0;
+    _static_ready = 0;
+    _static_current = -1;
     next_task_id = 1;
 }
 
@@ -110,7 +611,7 @@ void delay_ms(uint32_t ms) {
     if (ms == 0) return;
     uint32_t start = get_millis();
     while ((get_millis() - start) < ms) {
-        __WFI(); // GD32 mendukung __WFI()
+        tickless_sleep_until(start + ms, false);
     }
 }
 
@@ -118,10 +619,9 @@ void delay_ms(uint32_t ms) {
 uint32_t get_millis(void) {
     if (!systick_initialized) return 0;
 
-    uint32_t primask = __get_PRIMASK();
-    __disable_irq();
+    uint32_t primask = critical_enter();
     uint32_t current = systick_millis;
-    __set_PRIMASK(primask);
+    critical_exit(primask);
     return current;
 }
 
@@ -131,12 +631,19 @@ bool timeout_expired(uint32_t start_time, uint32_t timeout_ms) {
 }
 
 
-// --- Queue Management (Tetap) ---
+// --- Queue Management (lock-free SPSC ring per prioritas) ---
+// Satu-satunya producer adalah SysTick_Handler, satu-satunya consumer adalah
+// task_scheduler_run. Flag 'queued' di-set oleh producer dan di-clear oleh consumer,
+// sehingga setiap slot task paling banyak punya satu entri di semua ring dan ring
+// tidak pernah penuh selama TASK_READY_RING_SIZE >= MAX_TASK.
+// Suspend/stop dari thread tidak menyentuh ring; entri basi dibuang saat di-pop.
 void task_queue_init(void) {
     for (int i = 0; i < TASK_PRIORITY_COUNT; i++) {
-        _task_queues[i].head = NULL;
-        _task_queues[i].tail = NULL;
-        _task_queues[i].count = 0;
+        _task_queues[i].head = 0;
+        _task_queues[i].tail = 0;
+        _task_queues[i].overflows = 0;
+        _task_queues[i].backlog_head = NULL;
+        _task_queues[i].backlog_tail = NULL;
         _task_queues[i].priority = (task_priority_t)i;
     }
 }
@@ -146,81 +653,132 @@ bool task_queue_add(task_t *task) {
         return false;
     }
 
-    task_queue_t *queue = &_task_queues[task->priority];
+    // Sudah di antrian: cukup satu entri per task, tanpa menelusuri ring
+    if (task->queued) {
+        return true;
+    }
 
-    task_t *current = queue->head;
-    while (current != NULL) {
-        if (current == task) {
-            return true;
-        }
-        current = current->next;
+    task_queue_t *queue = &_task_queues[task->priority];
+    uint16_t head = queue->head;
+    if ((uint16_t)(head - queue->tail) >= TASK_READY_RING_SIZE) {
+        queue->overflows++;
+        return false;
     }
 
-    task->next = NULL;
+    task->queued = true;
+    queue->slots[head & READY_RING_MASK].slot = (uint16_t)(task - _tasks);
+    queue->slots[head & READY_RING_MASK].task_id = task->task_id;
+    __DMB(); // Entri harus terlihat sebelum head dipublikasikan
+    queue->head = head + 1;
+    DELAY_TRACE_RELEASE(task);
+    return true;
+}
 
-    if (queue->tail == NULL) {
-        queue->head = task;
-        queue->tail = task;
+// Antrian lokal catch-up: FIFO linked list per prioritas, hanya diakses dari thread
+static void task_backlog_push(task_t *task) {
+    task_queue_t *queue = &_task_queues[task->priority];
+    DELAY_TRACE_RELEASE(task);
+    task->next = NULL;
+    task->backlog_queued = true;
+    if (queue->backlog_tail == NULL) {
+        queue->backlog_head = task;
     } else {
-        queue->tail->next = task;
-        queue->tail = task;
+        queue->backlog_tail->next = task;
     }
+    queue->backlog_tail = task;
+}
 
-    queue->count++;
-    return true;
+static task_t* task_backlog_pop(task_queue_t *queue) {
+    task_t *task = queue->backlog_head;
+    if (task != NULL) {
+        queue->backlog_head = task->next;
+        if (queue->backlog_head == NULL) {
+            queue->backlog_tail = NULL;
+        }
+        task->next = NULL;
+        task->backlog_queued = false;
+    }
+    return task;
 }
 
-task_t* task_queue_get_next(void) {
-    for (int priority = TASK_PRIORITY_CRITICAL; priority >= TASK_PRIORITY_LOW; priority--) {
-        task_queue_t *queue = &_task_queues[priority];
-        if (queue->head != NULL) {
-            task_t *task = queue->head;
-            queue->head = task->next;
-            if (queue->head == NULL) {
-                queue->tail = NULL;
+// Pindahkan task yang menerima event ke antrian lokal prioritasnya. Bitmap diambil
+// secara atomik sehingga ISR boleh terus memposting event selama proses ini.
+static void task_event_dispatch(void) {
+    for (int word = 0; word < (MAX_TASK + 31) / 32; word++) {
+        if (_event_ready[word] == 0) {
+            continue;
+        }
+        uint32_t ready = atomic_take_u32(&_event_ready[word], 0xFFFFFFFFUL);
+        while (ready != 0) {
+            uint32_t bit = (uint32_t)__builtin_ctz(ready);
+            ready &= ready - 1;
+
+            task_t *task = &_tasks[word * 32 + bit];
+            if (task->state != TASK_RUNNING || (task->events_pending & task->event_mask) == 0) {
+                continue;   // Belum menunggu: event tetap tersimpan di events_pending
             }
-            queue->count--;
-            task->next = NULL;
-            return task;
+            // Rilis timeout yang sudah di ring ikut mengambil event ini
+            if (task->queued || task->backlog_queued) {
+                continue;
+            }
+            task_disarm(task);  // Batalkan timeout
+            task_backlog_push(task);
         }
     }
-    return NULL;
 }
 
-void task_queue_remove(task_t *task) {
-    if (task == NULL) return;
+// Pop task siap dengan prioritas >= min_priority
+static task_t* task_queue_pop(int min_priority) {
+    task_event_dispatch();
 
-    task_queue_t *queue = &_task_queues[task->priority];
+    for (int priority = TASK_PRIORITY_CRITICAL; priority >= min_priority; priority--) {
+        task_queue_t *queue = &_task_queues[priority];
+        uint16_t tail = queue->tail;
 
-    if (queue->head == task) {
-        queue->head = task->next;
-        if (queue->head == NULL) {
-            queue->tail = NULL;
-        }
-        queue->count--;
-        task->next = NULL;
-        return;
-    }
+        while (tail != queue->head) {
+            __DMB(); // Baca entri setelah head terlihat
+            task_ready_entry_t entry = queue->slots[tail & READY_RING_MASK];
+            tail++;
+            __DMB();
+            queue->tail = tail;
 
-    task_t *current = queue->head;
-    while (current != NULL && current->next != task) {
-        current = current->next;
-    }
+            task_t *task = &_tasks[entry.slot];
+            task->queued = false;
 
-    if (current != NULL && current->next == task) {
-        current->next = task->next;
-        if (queue->tail == task) {
-            queue->tail = current;
+            // Buang entri milik task yang sudah di-stop/suspend setelah dirilis
+            if (task->task_id == entry.task_id && task->state == TASK_RUNNING) {
+                task->backlog_run = false;
+                return task;
+            }
+        }
+
+        // Rilis baru didahulukan, baru kemudian eksekusi catch-up
+        task_t *task;
+        while ((task = task_backlog_pop(queue)) != NULL) {
+            if (task->state == TASK_RUNNING) {
+                task->backlog_run = true;
+                return task;
+            }
         }
-        queue->count--;
-        task->next = NULL;
     }
+    return NULL;
+}
+
+task_t* task_queue_get_next(void) {
+    return task_queue_pop(TASK_PRIORITY_LOW);
+}
+
+uint16_t task_queue_count(task_priority_t priority) {
+    if (priority >= TASK_PRIORITY_COUNT) return 0;
+    task_queue_t *queue = &_task_queues[priority];
+    return (uint16_t)(queue->head - queue->tail);
 }
 
 // --- Task Management (Diperbarui untuk uint16_t task_id dan tanpa use_systick) ---
 static task_t* find_free_task_slot(void) {
     for (int i = 0; i < MAX_TASK; i++) {
-        if (_tasks[i].state == TASK_STOPPED) {
+        // Slot oneshot yang sudah dirilis tapi belum dijalankan masih dipakai antrian
+        if (_tasks[i].state == TASK_STOPPED && !_tasks[i].queued && !_tasks[i].backlog_queued) {
             return &_tasks[i];
         }
     }
@@ -237,13 +795,55 @@ static task_t* find_task_by_callback(void (*cb)(void)) {
 }
 
 static task_t* find_task_by_id(uint16_t task_id) { // <-- Diperbarui parameter
-    for (int i = 0; i < MAX_TASK; i++) {
-        // Pastikan tugas tidak dalam keadaan STOPPED saat membandingkan ID
-        if (_tasks[i].task_id == task_id && _tasks[i].state != TASK_STOPPED) {
-            return &_tasks[i];
+    uint8_t slot = _id_slot[task_id & ID_MAP_MASK];
+    if (slot >= MAX_TASK) {
+        return NULL;
+    }
+    // Bucket bisa basi (task sudah STOPPED atau slot dipakai ID lain)
+    task_t *task = &_tasks[slot];
+    return (task->task_id == task_id && task->state != TASK_STOPPED) ? task : NULL;
+}
+
+// Lepas bucket ID lama milik slot ini
+static void task_id_unmap(task_t *task) {
+    uint8_t *entry = &_id_slot[task->task_id & ID_MAP_MASK];
+    if (task->task_id != INVALID_TASK_ID && *entry == (uint8_t)(task - _tasks)) {
+        *entry = ID_MAP_NONE;
+    }
+}
+
+// Indeks entri tabel statis dari ID, -1 jika bukan task statis
+static int task_static_index(uint16_t task_id) {
+    if (task_id < TASK_STATIC_ID_BASE || (uint16_t)(task_id - TASK_STATIC_ID_BASE) >= _static_count) {
+        return -1;
+    }
+    return task_id - TASK_STATIC_ID_BASE;
+}
+
+static int task_static_by_callback(void (*cb)(void)) {
+    for (uint8_t i = 0; i < _static_count; i++) {
+        if (_static_defs[i].cb == cb) {
+            return i;
+        }
+    }
+    return -1;
+}
+
+// ID task dinamis tidak pernah masuk rentang ID task statis. ID yang bucket-nya masih
+// dipakai task hidup dilompati; selalu ada bucket bebas karena slot 'task' sendiri
+// belum hidup dan TASK_ID_MAP_SIZE >= MAX_TASK.
+static uint16_t task_alloc_id(task_t *task) {
+    task_id_unmap(task);
+    for (;;) {
+        uint16_t id = next_task_id++;
+        // Tangani overflow next_task_id
+        if (next_task_id == 0 || next_task_id >= TASK_STATIC_ID_BASE) next_task_id = 1; // Hindari ID 0
+        uint8_t *entry = &_id_slot[id & ID_MAP_MASK];
+        if (*entry == ID_MAP_NONE || _tasks[*entry].state == TASK_STOPPED) {
+            *entry = (uint8_t)(task - _tasks);
+            return id;
         }
     }
-    return NULL;
 }
 
 // Diperbarui: Hapus 'use_systick', gunakan uint16_t untuk task_id
@@ -254,21 +854,22 @@ uint16_t task_start_ex(void (*cb)(void), uint32_t interval_ms, task_priority_t p
     }
 
     task->cb = cb;
+    task->co = NULL;
     task->semaphore = NULL;
     task->interval_ms = interval_ms;
-    task->counter_ms = interval_ms;
     task->last_run_ms = get_millis();
     task->state = TASK_RUNNING;
     task->type = TASK_TYPE_CALLBACK;
     task->oneshot = oneshot;
     // task->use_systick = true; // <-- Dihapus
     task->priority = priority;
-    task->task_id = next_task_id++;
+    task->task_id = task_alloc_id(task);
     task->next = NULL;
+    task_overrun_clear(task);
+    task_event_clear(task);
+    task_stats_clear(task);
 
-    // Tangani overflow next_task_id
-    if (next_task_id == 0) next_task_id = 1; // Hindari ID 0
-
+    task_arm(task);
     return task->task_id; // <-- Diperbarui
 }
 
@@ -292,59 +893,279 @@ bool task_start_semaphore_priority(volatile uint8_t *sem, uint32_t interval_ms,
     }
 
     task->cb = NULL;
+    task->co = NULL;
     task->semaphore = sem;
     task->interval_ms = interval_ms;
-    task->counter_ms = interval_ms;
     task->last_run_ms = get_millis();
     task->state = TASK_RUNNING;
     task->type = TASK_TYPE_SEMAPHORE;
     task->oneshot = false;
     // task->use_systick = true; // <-- Dihapus
     task->priority = priority;
-    task->task_id = next_task_id++;
+    task->task_id = task_alloc_id(task);
+    task->next = NULL;
+    task_overrun_clear(task);
+    task_event_clear(task);
+    task_stats_clear(task);
+
+    task_arm(task);
+    return true;
+}
+
+// Diperbarui: Coroutine mulai secepatnya; setelah TASK_CO_END diulang tiap interval_ms (0 = berhenti)
+uint16_t task_start_coroutine(task_co_fn_t co, uint32_t interval_ms, task_priority_t priority) {
+    if (co == NULL) {
+        return INVALID_TASK_ID;
+    }
+
+    task_t *task = find_free_task_slot();
+    if (task == NULL) {
+        return INVALID_TASK_ID;
+    }
+
+    task->cb = NULL;
+    task->co = co;
+    task->co_line = 0;
+    task->co_wait_ms = 0;
+    task->semaphore = NULL;
+    task->interval_ms = interval_ms;
+    task->last_run_ms = get_millis();
+    task->state = TASK_RUNNING;
+    task->type = TASK_TYPE_COROUTINE;
+    task->oneshot = false;
+    task->priority = priority;
+    task->task_id = task_alloc_id(task);
     task->next = NULL;
+    task_overrun_clear(task);
+    task_event_clear(task);
+    task_stats_clear(task);
+
+    task_backlog_push(task);
+    return task->task_id;
+}
+
+// Callback dijalankan saat salah satu bit event_mask diposting, atau setelah
+// timeout_ms tanpa event (0 = tanpa timeout)
+uint16_t task_start_event(void (*cb)(void), uint32_t event_mask, uint32_t timeout_ms, task_priority_t priority) {
+    if (cb == NULL || event_mask == 0) {
+        return INVALID_TASK_ID;
+    }
+
+    task_t *task = find_free_task_slot();
+    if (task == NULL) {
+        return INVALID_TASK_ID;
+    }
+
+    task->cb = cb;
+    task->co = NULL;
+    task->semaphore = NULL;
+    task->interval_ms = timeout_ms;
+    task->last_run_ms = get_millis();
+    task->state = TASK_RUNNING;
+    task->type = TASK_TYPE_EVENT;
+    task->oneshot = false;
+    task->priority = priority;
+    task->task_id = task_alloc_id(task);
+    task->next = NULL;
+    task_overrun_clear(task);
+    task_event_clear(task);
+    task_stats_clear(task);
+    task->event_mask = event_mask;
+
+    task_arm(task);
+    return task->task_id;
+}
+
+// Entri ke-i punya ID TASK_STATIC_ID(i). Ukuran tabel dan isi entri sudah dicek saat
+// compile oleh TASK_TABLE_DEFINE, begitu juga prio_mask (bit entri per prioritas, urutan
+// dispatch: prioritas tertinggi dulu, lalu urutan tabel); hanya satu tabel yang bisa aktif.
+bool task_table_start(const task_def_t *defs, const uint32_t *prio_mask, task_static_t *state, uint16_t count) {
+    if (defs == NULL || prio_mask == NULL || state == NULL || count == 0 || count > TASK_TABLE_MAX
+        || _static_count > 0) {
+        return false;
+    }
+
+    uint32_t now = get_millis();
+    uint32_t next = now + defs[0].interval_ms;
+    for (uint16_t i = 0; i < count; i++) {
+        memset(&state[i], 0, sizeof(state[i]));
+        state[i].deadline_ms = now + defs[i].interval_ms;
+        state[i].prev_release_ms = now;
+#if TASK_PROFILER_ENABLE
+        state[i].stats.cycles_min = UINT32_MAX;
+#endif
+        if (TIME_BEFORE(state[i].deadline_ms, next)) {
+            next = state[i].deadline_ms;
+        }
+    }
+
+    uint32_t primask = critical_enter();
+    _static_defs = defs;
+    _static_prio_mask = prio_mask;
+    _static_tasks = state;
+    _static_ready = 0;
+    _static_next_ms = next;
+    _static_count = (uint8_t)count;
+    _static_active = (count == 32) ? 0xFFFFFFFFUL : ((1UL << count) - 1);
+    critical_exit(primask);
+    return true;
+}
+
+static bool task_static_suspend(int index) {
+    uint32_t bit = 1UL << index;
+    if ((_static_active & bit) == 0) {
+        return false;
+    }
+    uint32_t primask = critical_enter();
+    _static_active &= ~bit;
+    _static_ready &= ~bit;      // Rilis yang belum dijalankan dibatalkan
+    critical_exit(primask);
+    return true;
+}
+
+// Mulai periode baru dari sekarang
+static bool task_static_resume(int index) {
+    uint32_t bit = 1UL << index;
+    if (_static_active & bit) {
+        return false;
+    }
+    task_static_t *st = &_static_tasks[index];
+    uint32_t primask = critical_enter();
+    st->prev_release_ms = systick_millis;
+    st->deadline_ms = systick_millis + _static_defs[index].interval_ms;
+    if (_static_active == 0 || TIME_BEFORE(st->deadline_ms, _static_next_ms)) {
+        _static_next_ms = st->deadline_ms;
+    }
+    _static_active |= bit;
+    critical_exit(primask);
+    return true;
+}
 
-    // Tangani overflow next_task_id
-    if (next_task_id == 0) next_task_id = 1; // Hindari ID 0
+// Aman dari ISR: hanya OR atomik ke task dan bitmap, tanpa menyentuh antrian.
+// Event untuk task yang sedang suspend disimpan sampai di-resume.
+bool task_post_event(uint16_t task_id, uint32_t mask) {
+    if (mask == 0) {
+        return false;
+    }
 
+    task_t *task = find_task_by_id(task_id);
+    if (task == NULL) {
+        return false;
+    }
+
+    uint32_t slot = (uint32_t)(task - _tasks);
+    atomic_or_u32(&task->events_pending, mask);
+    atomic_or_u32(&_event_ready[slot / 32], 1UL << (slot % 32));
     return true;
 }
 
+uint32_t task_current_events(void) {
+    return (_current_task != NULL) ? _current_task->events : 0;
+}
+
+static void task_stop(task_t *task) {
+    task_disarm(task);
+    task->state = TASK_STOPPED;
+    task->cb = NULL;
+    task->co = NULL;
+    task->semaphore = NULL;
+    task->interval_ms = 0;
+    task->oneshot = false;
+    task->event_mask = 0;
+    task_id_unmap(task);
+    task->task_id = INVALID_TASK_ID;
+}
+
+// Jadwalkan langkah coroutine berikutnya sesuai status yang dikembalikan
+static void task_co_step(task_t *task) {
+    uint16_t task_id = task->task_id;
+    task_co_status_t status = task->co(task);
+
+    // Coroutine menghentikan/menangguhkan dirinya sendiri
+    if (task->task_id != task_id || task->state != TASK_RUNNING) {
+        return;
+    }
+
+    switch (status) {
+        case TASK_CO_YIELDED:
+            if (!task->backlog_queued) {
+                task_backlog_push(task);
+            }
+            break;
+
+        case TASK_CO_WAITING:
+            if (task->event_mask == 0) {
+                task_arm_delay(task, (task->co_wait_ms > 0) ? task->co_wait_ms : 1);
+            } else if (task->events_pending & task->event_mask) {
+                // Event sudah datang sebelum mulai menunggu
+                if (!task->backlog_queued) {
+                    task_backlog_push(task);
+                }
+            } else {
+                task_arm_delay(task, task->co_wait_ms);
+            }
+            break;
+
+        case TASK_CO_ENDED:
+            task->co_line = 0;
+            if (task->interval_ms > 0) {
+                task_arm(task);
+            } else {
+                task_stop(task);
+            }
+            break;
+    }
+}
+
 // ... (Fungsi kontrol task lainnya seperti suspend/resume/stop) ...
 
+// Coroutine dilanjutkan dari titik terakhir, task lain mulai periode baru.
+// Event yang diterima selama suspend langsung membangunkan task.
+static void task_resume_schedule(task_t *task) {
+    bool event_ready = (task->events_pending & task->event_mask) != 0;
+    if (task->type == TASK_TYPE_COROUTINE || event_ready) {
+        if (!task->backlog_queued) {
+            task_backlog_push(task);
+        }
+    } else {
+        task_arm(task);
+    }
+}
+
 bool task_suspend_by_callback(void (*cb)(void)) {
+    int index = task_static_by_callback(cb);
+    if (index >= 0) {
+        return task_static_suspend(index);
+    }
     task_t *task = find_task_by_callback(cb);
     if (task != NULL && task->state == TASK_RUNNING) {
         task->state = TASK_SUSPENDED;
-        task_queue_remove(task);
+        task_disarm(task);
         return true;
     }
     return false;
 }
 
 bool task_resume_by_callback(void (*cb)(void)) {
+    int index = task_static_by_callback(cb);
+    if (index >= 0) {
+        return task_static_resume(index);
+    }
     task_t *task = find_task_by_callback(cb);
     if (task != NULL && task->state == TASK_SUSPENDED) {
         task->state = TASK_RUNNING;
         task->last_run_ms = get_millis();
-        task->counter_ms = task->interval_ms;
+        task_resume_schedule(task);
         return false;
     }
     return false;
 }
 
+// Task statis tidak bisa di-stop (ID-nya tetap), gunakan suspend
 bool task_stop_by_callback(void (*cb)(void)) {
     task_t *task = find_task_by_callback(cb);
     if (task != NULL) {
-        task->state = TASK_STOPPED;
-        task->cb = NULL;
-        task->semaphore = NULL;
-        task->interval_ms = 0;
-        task->counter_ms = 0;
-        task->oneshot = false;
-        // task->use_systick = false; // <-- Dihapus
-        task->task_id = INVALID_TASK_ID; // <-- Diperbarui
-        task_queue_remove(task);
+        task_stop(task);
         return true;
     }
     return false;
@@ -352,10 +1173,14 @@ bool task_stop_by_callback(void (*cb)(void)) {
 
 // Diperbarui: Gunakan uint16_t untuk task_id
 bool task_suspend_by_id(uint16_t task_id) { // <-- Diperbarui parameter
+    int index = task_static_index(task_id);
+    if (index >= 0) {
+        return task_static_suspend(index);
+    }
     task_t *task = find_task_by_id(task_id);
     if (task != NULL && task->state == TASK_RUNNING) {
         task->state = TASK_SUSPENDED;
-        task_queue_remove(task);
+        task_disarm(task);
         return true;
     }
     return false;
@@ -363,11 +1188,15 @@ bool task_suspend_by_id(uint16_t task_id) { // <-- Diperbarui parameter
 
 // Diperbarui: Gunakan uint16_t untuk task_id
 bool task_resume_by_id(uint16_t task_id) { // <-- Diperbarui parameter
+    int index = task_static_index(task_id);
+    if (index >= 0) {
+        return task_static_resume(index);
+    }
     task_t *task = find_task_by_id(task_id);
     if (task != NULL && task->state == TASK_SUSPENDED) {
         task->state = TASK_RUNNING;
         task->last_run_ms = get_millis();
-        task->counter_ms = task->interval_ms;
+        task_resume_schedule(task);
         return true;
     }
     return false;
@@ -377,22 +1206,14 @@ bool task_resume_by_id(uint16_t task_id) { // <-- Diperbarui parameter
 bool task_stop_by_id(uint16_t task_id) { // <-- Diperbarui parameter
     task_t *task = find_task_by_id(task_id);
     if (task != NULL) {
-        task->state = TASK_STOPPED;
-        task->cb = NULL;
-        task->semaphore = NULL;
-        task->interval_ms = 0;
-        task->counter_ms = 0;
-        task->oneshot = false;
-        // task->use_systick = false; // <-- Dihapus
-        task->task_id = INVALID_TASK_ID; // <-- Diperbarui
-        task_queue_remove(task);
+        task_stop(task);
         return true;
     }
     return false;
 }
 
 uint8_t get_active_task_count(void) {
-    uint8_t count = 0;
+    uint8_t count = _static_count;
     for (int i = 0; i < MAX_TASK; i++) {
         if (_tasks[i].state != TASK_STOPPED) {
             count++;
@@ -401,9 +1222,138 @@ uint8_t get_active_task_count(void) {
     return count;
 }
 
-void task_scheduler_run(void) {
-    task_t *task = task_queue_get_next();
+#if TASK_PROFILER_ENABLE
+// Deadline implisit = period_ms (0 = tanpa deadline, misalnya oneshot)
+static void task_stats_record(task_stats_t *st, uint32_t period_ms, uint32_t release_ms,
+                              uint32_t start_ms, uint32_t cycles) {
+    uint32_t latency = start_ms - release_ms;
+
+    st->run_count++;
+    st->cycles_total += cycles;
+    if (cycles < st->cycles_min) st->cycles_min = cycles;
+    if (cycles > st->cycles_max) st->cycles_max = cycles;
+    st->latency_total_ms += latency;
+    if (latency > st->latency_max_ms) st->latency_max_ms = latency;
+
+    if (period_ms > 0 && (get_millis() - release_ms) > period_ms) {
+        st->deadline_misses++;
+    }
+}
+#endif
+
+// Hitung periode aktual dan aktivasi yang diwakili eksekusi ini (sebelum callback)
+static uint32_t task_begin_activation(task_t *task) {
+    uint32_t release_ms;
+    if (task->backlog_run && (task->type == TASK_TYPE_COROUTINE || task->type == TASK_TYPE_EVENT)) {
+        // Lanjutan setelah TASK_CO_YIELD atau bangun karena event: dianggap rilis saat ini
+        release_ms = systick_millis;
+    } else if (task->backlog_run) {
+        // Catch-up: rilis logis satu periode setelah eksekusi sebelumnya
+        release_ms = task->prev_release_ms + task->interval_ms;
+    } else {
+        release_ms = task->last_run_ms;
+    }
+    task->period_ms = release_ms - task->prev_release_ms;
+    task->prev_release_ms = release_ms;
+    task->activations = 1;
+
+    if (task->overrun_policy != TASK_OVERRUN_CATCHUP) {
+        uint32_t overruns = task->overruns;
+        if (task->overrun_policy == TASK_OVERRUN_COALESCE) {
+            uint32_t merged = overruns - task->overruns_seen;
+            task->activations = (merged >= UINT16_MAX) ? UINT16_MAX : (uint16_t)(merged + 1);
+        }
+        task->overruns_seen = overruns;
+    }
+    return release_ms;
+}
+
+// CATCHUP: jadwalkan eksekusi tambahan untuk aktivasi yang masih tertunggak
+static void task_end_activation(task_t *task) {
+    if (task->overrun_policy != TASK_OVERRUN_CATCHUP || task->state != TASK_RUNNING) {
+        return;
+    }
+
+    uint32_t backlog = task->overruns - task->overruns_seen;
+    if (backlog > TASK_CATCHUP_MAX) {
+        task->overruns_seen += backlog - TASK_CATCHUP_MAX;
+        backlog = TASK_CATCHUP_MAX;
+    }
+    if (backlog > 0 && !task->backlog_queued) {
+        task->overruns_seen++;
+        task->caught_up++;
+        task_backlog_push(task);
+    }
+}
+
+// Prioritas tertinggi yang punya task statis siap, -1 jika tidak ada
+static int task_static_ready_priority(void) {
+    uint32_t ready = _static_ready;
+    if (ready == 0) {
+        return -1;
+    }
+    for (int priority = TASK_PRIORITY_CRITICAL; priority > TASK_PRIORITY_LOW; priority--) {
+        if (ready & _static_prio_mask[priority]) {
+            return priority;
+        }
+    }
+    return TASK_PRIORITY_LOW;
+}
+
+static void task_static_run(int priority) {
+    uint32_t primask = critical_enter();
+    uint32_t pending = _static_ready & _static_prio_mask[priority];
+    int index = __builtin_ctz(pending);     // Urutan tabel di dalam satu prioritas
+    _static_ready &= ~(1UL << index);
+    task_static_t *st = &_static_tasks[index];
+    uint32_t release_ms = st->release_ms;
+    critical_exit(primask);
+
+    const task_def_t *def = &_static_defs[index];
+#if TASK_PROFILER_ENABLE
+    uint32_t start_ms = get_millis();
+    uint32_t start_cycles = dwt_get_cycle();
+#endif
+
+    _static_current = (int8_t)index;
+    DELAY_TRACE_STATIC_START(TASK_STATIC_ID(index), def->priority);
+    def->cb();
+    DELAY_TRACE_END(TASK_STATIC_ID(index), def->priority);
+    _static_current = -1;
+
+#if TASK_PROFILER_ENABLE
+    task_stats_record(&st->stats, def->interval_ms, release_ms, start_ms, dwt_get_cycle() - start_cycles);
+#endif
+    st->prev_release_ms = release_ms;
+}
+
+// Jalankan satu task siap (prioritas tertinggi), false jika antrian kosong
+static bool task_run_next(void) {
+    int static_priority = task_static_ready_priority();
+    task_t *task = task_queue_pop(static_priority + 1);
+    if (task == NULL && static_priority >= 0) {
+        task_static_run(static_priority);
+        return true;
+    }
     if (task != NULL) {
+        uint16_t task_id = task->task_id;
+        uint32_t release_ms = task_begin_activation(task);
+#if TASK_PROFILER_ENABLE
+        uint32_t start_ms = get_millis();
+        uint32_t start_cycles = dwt_get_cycle();
+#endif
+
+        // Oneshot selesai begitu dijalankan; callback boleh langsung menjadwalkan ulang
+        if (task->oneshot) {
+            task->state = TASK_STOPPED;
+        }
+
+        // Event yang diambil di sini milik eksekusi ini; yang datang setelahnya
+        // membangunkan task lagi
+        task->events = (task->event_mask != 0) ? atomic_take_u32(&task->events_pending, task->event_mask) : 0;
+
+        _current_task = task;
+        DELAY_TRACE_START(task);
         switch (task->type) {
             case TASK_TYPE_SEMAPHORE:
                 if (task->semaphore != NULL) {
@@ -417,6 +1367,210 @@ void task_scheduler_run(void) {
                     task->cb();
                 }
                 break;
+
+            case TASK_TYPE_COROUTINE:
+                if (task->co != NULL) {
+                    task_co_step(task);
+                }
+                break;
+
+            case TASK_TYPE_EVENT:
+                if (task->cb != NULL) {
+                    task->cb();
+                }
+                // Timeout dihitung ulang dari eksekusi terakhir
+                if (task->task_id == task_id && task->state == TASK_RUNNING) {
+                    task_arm(task);
+                }
+                break;
+        }
+        _current_task = NULL;
+        DELAY_TRACE_END(task_id, task->priority);
+
+        // Lewati jika slot dipakai ulang oleh callback (misalnya oneshot menjadwalkan diri lagi)
+        if (task->task_id == task_id) {
+#if TASK_PROFILER_ENABLE
+            task_stats_record(&task->stats, task->oneshot ? 0 : task->interval_ms, release_ms, start_ms,
+                              dwt_get_cycle() - start_cycles);
+#else
+            (void)release_ms;
+#endif
+            task_end_activation(task);
+        }
+    }
+    return task != NULL;
+}
+
+// Setiap task dipilih ulang dari prioritas tertinggi, jadi rilis baru dengan
+// prioritas lebih tinggi langsung menyela batch. Budget dicek di antara task
+// (task yang sedang berjalan tidak pernah dipotong).
+void task_scheduler_run(void) {
+    uint32_t budget = _drain_budget_cycles;
+    uint32_t start_cycles = dwt_get_cycle();
+    uint32_t ran = 0;
+    uint32_t elapsed = 0;
+    while (task_run_next()) {
+        ran++;
+        elapsed = dwt_get_cycle() - start_cycles;
+        if (budget == 0 || elapsed >= budget) {
+            if (budget > 0 && ready_queue_pending()) {
+                _drain_stats.budget_exhausted++;
+            }
+            break;
+        }
+    }
+
+    if (ran > 0) {
+        _drain_stats.batches++;
+        _drain_stats.tasks += ran;
+        if (ran > _drain_stats.max_batch) _drain_stats.max_batch = ran;
+        if (elapsed > _drain_stats.max_cycles) _drain_stats.max_cycles = elapsed;
+    }
+}
+
+void task_scheduler_set_drain_budget(uint32_t cycles) {
+    _drain_budget_cycles = cycles;
+}
+
+void task_get_drain_stats(task_drain_stats_t *stats) {
+    if (stats == NULL) return;
+    *stats = _drain_stats;
+}
+
+void task_reset_drain_stats(void) {
+    memset(&_drain_stats, 0, sizeof(_drain_stats));
+}
+
+// --- Overrun / Periode Aktual ---
+// Task statis selalu TASK_OVERRUN_SKIP
+bool task_set_overrun_policy(uint16_t task_id, task_overrun_policy_t policy) {
+    if (task_static_index(task_id) >= 0) {
+        return policy == TASK_OVERRUN_SKIP;
+    }
+    task_t *task = find_task_by_id(task_id);
+    if (task == NULL) return false;
+    task->overruns_seen = task->overruns;
+    task->overrun_policy = policy;
+    return true;
+}
+
+uint32_t task_get_missed_activations(uint16_t task_id) {
+    int index = task_static_index(task_id);
+    if (index >= 0) {
+        return _static_tasks[index].overruns;
+    }
+    task_t *task = find_task_by_id(task_id);
+    if (task == NULL) return 0;
+    return task->overruns - task->caught_up;
+}
+
+uint32_t task_current_period_ms(void) {
+    if (_static_current >= 0) {
+        const task_static_t *st = &_static_tasks[_static_current];
+        return st->release_ms - st->prev_release_ms;
+    }
+    return (_current_task != NULL) ? _current_task->period_ms : 0;
+}
+
+// Task statis selalu satu aktivasi per eksekusi (SKIP)
+uint16_t task_current_activations(void) {
+    if (_static_current >= 0) {
+        return 1;
+    }
+    return (_current_task != NULL) ? _current_task->activations : 0;
+}
+
+// --- Profiler ---
+#if TASK_PROFILER_ENABLE
+// Nama task statis diambil dari tabel
+bool task_set_name(uint16_t task_id, const char *name) {
+    task_t *task = find_task_by_id(task_id);
+    if (task == NULL) return false;
+    task->name = name;
+    return true;
+}
+
+bool task_get_stats(uint16_t task_id, task_stats_t *stats) {
+    int index = task_static_index(task_id);
+    if (index >= 0 && stats != NULL) {
+        *stats = _static_tasks[index].stats;
+        return true;
+    }
+    task_t *task = find_task_by_id(task_id);
+    if (task == NULL || stats == NULL) return false;
+    *stats = task->stats;
+    return true;
+}
+
+static void task_stats_zero(task_stats_t *st) {
+    memset(st, 0, sizeof(*st));
+    st->cycles_min = UINT32_MAX;
+}
+
+void task_reset_stats(uint16_t task_id) {
+    for (int i = 0; i < MAX_TASK; i++) {
+        if (_tasks[i].state == TASK_STOPPED) continue;
+        if (task_id == INVALID_TASK_ID || _tasks[i].task_id == task_id) {
+            task_stats_zero(&_tasks[i].stats);
         }
     }
-}
\ No newline at end of file
+    for (uint8_t i = 0; i < _static_count; i++) {
+        if (task_id == INVALID_TASK_ID || TASK_STATIC_ID(i) == task_id) {
+            task_stats_zero(&_static_tasks[i].stats);
+        }
+    }
+}
+
+static void task_stats_format(char *line, size_t size, uint16_t task_id, const char *name,
+                              task_priority_t priority, const task_stats_t *st, uint32_t cycles_per_us) {
+    uint32_t runs = st->run_count;
+    uint32_t avg = runs ? (uint32_t)(st->cycles_total / runs) : 0;
+    uint32_t min = runs ? st->cycles_min : 0;
+    uint32_t lat_avg = runs ? (st->latency_total_ms / runs) : 0;
+
+    snprintf(line, size, "%-5u %-12.12s %-4u %-10lu %6lu/%6lu/%6lu  %6lu/%-6lu %lu",
+             task_id, name ? name : "-", (unsigned)priority,
+             (unsigned long)runs,
+             (unsigned long)(min / cycles_per_us), (unsigned long)(avg / cycles_per_us),
+             (unsigned long)(st->cycles_max / cycles_per_us),
+             (unsigned long)lat_avg, (unsigned long)st->latency_max_ms,
+             (unsigned long)st->deadline_misses);
+}
+
+void task_stats_dump(void (*print)(const char *line)) {
+    if (print == NULL) return;
+
+    char line[128];     // Baris terpanjang 108 karakter + NUL
+    uint32_t cycles_per_us = rcu_clock_freq_get(CK_AHB) / 1000000;
+    if (cycles_per_us == 0) cycles_per_us = 1;
+
+    print("id    name         prio runs       us min/   avg/   max  lat ms avg/max  miss");
+    for (uint8_t i = 0; i < _static_count; i++) {
+        task_stats_format(line, sizeof(line), TASK_STATIC_ID(i), _static_defs[i].name,
+                          _static_defs[i].priority, &_static_tasks[i].stats, cycles_per_us);
+        print(line);
+    }
+    for (int i = 0; i < MAX_TASK; i++) {
+        task_t *task = &_tasks[i];
+        if (task->state == TASK_STOPPED) continue;
+
+        task_stats_format(line, sizeof(line), task->task_id, task->name, task->priority,
+                          &task->stats, cycles_per_us);
+        print(line);
+    }
+}
+
+static void task_stats_dump_task(void) {
+    task_stats_dump(_stats_print);
+}
+
+uint16_t task_stats_start_dump(void (*print)(const char *line), uint32_t interval_ms) {
+    if (print == NULL) return INVALID_TASK_ID;
+
+    _stats_print = print;
+    task_stop_by_callback(task_stats_dump_task);
+    uint16_t id = task_start_ex(task_stats_dump_task, interval_ms, TASK_PRIORITY_LOW, false);
+    task_set_name(id, "stats_dump");
+    return id;
+}
+#endif
\ No newline at end of file
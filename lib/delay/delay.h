@@ -2,7 +2,11 @@
 #define DELAY_H
 
 #include <stdint.h>
+#ifdef DELAY_HOST_SIM
+#include "delay_sim.h"          // SysTick/DWT virtual untuk build di host
+#else
 #include <gd32f3x0.h>
+#endif
 
 // Definisi enum & struct (sama seperti sebelumnya)
 typedef enum {
@@ -22,31 +26,284 @@ typedef enum {
 typedef enum {
     TASK_TYPE_CALLBACK,
     TASK_TYPE_SEMAPHORE,
-    TASK_TYPE_DELAYED_CALLBACK
+    TASK_TYPE_DELAYED_CALLBACK,
+    TASK_TYPE_COROUTINE,
+    TASK_TYPE_EVENT
 } task_type_t;
 
+// Kebijakan saat aktivasi periodik terlewat (task masih antri atau rilis terlambat)
+typedef enum {
+    TASK_OVERRUN_SKIP,          // Aktivasi yang terlewat dibuang, fase jadwal tetap
+    TASK_OVERRUN_CATCHUP,       // Setiap aktivasi yang terlewat tetap dijalankan (maks TASK_CATCHUP_MAX)
+    TASK_OVERRUN_COALESCE       // Aktivasi yang terlewat digabung ke satu eksekusi
+} task_overrun_policy_t;
+
+#ifndef TASK_CATCHUP_MAX
+#define TASK_CATCHUP_MAX 4
+#endif
+
+// Profiler per task (siklus diukur dengan DWT CYCCNT)
+#ifndef TASK_PROFILER_ENABLE
+#define TASK_PROFILER_ENABLE 1
+#endif
+
+typedef struct {
+    uint32_t run_count;
+    uint32_t cycles_min;
+    uint32_t cycles_max;
+    uint64_t cycles_total;      // Rata-rata = cycles_total / run_count
+    uint32_t latency_max_ms;    // Rilis (last_run_ms) sampai callback mulai
+    uint32_t latency_total_ms;
+    uint32_t deadline_misses;   // Selesai setelah rilis + interval_ms
+} task_stats_t;
+
 typedef struct task task_t;
+
+// Coroutine (protothread) tanpa stack: fungsi dipanggil ulang dan melanjutkan dari
+// titik TASK_CO_* terakhir. Variabel lokal tidak bertahan antar langkah, gunakan static.
+typedef enum {
+    TASK_CO_YIELDED,            // Lanjutkan setelah task lain di antrian mendapat giliran
+    TASK_CO_WAITING,            // Lanjutkan setelah co_wait_ms
+    TASK_CO_ENDED               // Selesai (diulang setelah interval_ms jika > 0)
+} task_co_status_t;
+
+typedef task_co_status_t (*task_co_fn_t)(task_t *self);
+
 struct task {
     void (*cb)(void);
+    task_co_fn_t co;
+    uint16_t co_line;           // Titik lanjut coroutine (__LINE__), 0 = awal
+    uint32_t co_wait_ms;
     volatile uint8_t *semaphore;
     uint32_t interval_ms;
-    uint32_t counter_ms;
+    uint32_t deadline_ms;       // Waktu absolut (systick_millis) rilis berikutnya
     uint32_t last_run_ms;
     task_state_t state;
     task_type_t type;
     bool oneshot;
+    volatile bool queued;       // Sudah ada di antrian prioritas
     task_priority_t priority;
     uint16_t task_id;
-    task_t *next;
+    uint16_t heap_index;        // Posisi di timer heap, TIMER_HEAP_NONE jika tidak aktif
+    task_t *next;               // Link antrian lokal (thread) untuk eksekusi catch-up
+
+    // Overrun: 'overruns' hanya ditulis ISR, sisanya hanya ditulis thread
+    task_overrun_policy_t overrun_policy;
+    volatile uint32_t overruns; // Aktivasi yang jatuh saat task masih antri/terlambat
+    uint32_t overruns_seen;     // Overrun yang sudah diproses consumer
+    uint32_t caught_up;         // Overrun yang tetap dijalankan (CATCHUP)
+    uint32_t prev_release_ms;
+    uint32_t period_ms;         // Jarak rilis aktual untuk eksekusi sekarang
+    uint16_t activations;       // Jumlah aktivasi yang diwakili eksekusi sekarang
+    bool backlog_queued;        // Ada di antrian lokal
+    bool backlog_run;           // Eksekusi sekarang berasal dari antrian lokal
+
+    // Event: 'events_pending' di-OR secara atomik dari ISR mana pun
+    volatile uint32_t events_pending;
+    uint32_t event_mask;        // Bit yang membangunkan task, 0 = tidak menunggu event
+    uint32_t events;            // Event milik eksekusi sekarang (0 = timeout)
+#if TASK_PROFILER_ENABLE
+    const char *name;
+    task_stats_t stats;
+#endif
 };
 
+// Jumlah slot task. Biaya ISR tidak tergantung nilai ini (lihat timer heap di delay.c),
+// tapi RAM-nya iya: bisa dinaikkan lewat build_flags (-D MAX_TASK=...) selama masih
+// dalam DELAY_RAM_BUDGET.
+#ifndef MAX_TASK
+#define MAX_TASK 16
+#endif
+
+// Ukuran ring antrian siap per prioritas (harus pangkat dua dan >= MAX_TASK)
+#ifndef TASK_READY_RING_SIZE
+#define TASK_READY_RING_SIZE 16
+#endif
+
+// Ukuran tabel ID -> slot untuk lookup O(1) di task_post_event (harus pangkat dua dan
+// >= MAX_TASK). Lebih besar = lebih jarang ID dilompati saat alokasi.
+#ifndef TASK_ID_MAP_SIZE
+#define TASK_ID_MAP_SIZE 32
+#endif
+
+// Batas RAM statis scheduler (slot task, ring, timer heap), dicek saat compile.
+// GD32F350 hanya punya 16 KB SRAM.
+#ifndef DELAY_RAM_BUDGET
+#define DELAY_RAM_BUDGET 4096
+#endif
+
+typedef struct {
+    uint16_t slot;              // Indeks task di _tasks[]
+    uint16_t task_id;           // ID saat dirilis, untuk membuang entri basi
+} task_ready_entry_t;
+
+// Ring single-producer/single-consumer tanpa lock:
+// SysTick_Handler hanya menulis head, task_scheduler_run hanya menulis tail.
 typedef struct {
-    task_t *head;
-    task_t *tail;
-    uint8_t count;
+    task_ready_entry_t slots[TASK_READY_RING_SIZE];
+    volatile uint16_t head;
+    volatile uint16_t tail;
+    uint32_t overflows;         // Rilis yang gagal karena ring penuh
+    task_t *backlog_head;       // Antrian lokal catch-up, hanya disentuh thread
+    task_t *backlog_tail;
     task_priority_t priority;
 } task_queue_t;
 
+// Statistik SysTick_Handler (dalam siklus CPU, diukur dengan DWT CYCCNT)
+typedef struct {
+    uint32_t ticks;             // Jumlah tick yang diukur
+    uint32_t releases;          // Total task yang dirilis ke antrian
+    uint32_t last_cycles;       // Durasi ISR terakhir
+    uint32_t max_cycles;        // Durasi ISR terlama
+    uint32_t max_idle_cycles;   // Durasi ISR terlama saat tidak ada task yang jatuh tempo
+} systick_isr_stats_t;
+
+// Statistik mode tickless idle
+typedef struct {
+    uint32_t sleeps;            // Jumlah tidur panjang (SysTick diperpanjang)
+    uint32_t slept_ms;          // Total milidetik yang dilewati tanpa interupsi SysTick
+    uint32_t early_wakeups;     // Bangun sebelum deadline karena interupsi lain
+} tickless_stats_t;
+
+// Konfigurasi tickless idle (bisa di-override lewat build_flags)
+#ifndef DELAY_TICKLESS_ENABLE
+#define DELAY_TICKLESS_ENABLE       1
+#endif
+#ifndef DELAY_TICKLESS_MIN_IDLE_MS
+#define DELAY_TICKLESS_MIN_IDLE_MS  2   // Di bawah ini cukup __WFI() biasa
+#endif
+
+// Mode drain task_scheduler_run: jalankan task siap sampai antrian kosong atau
+// budget siklus CPU habis. 0 = satu task per panggilan (perilaku lama).
+#ifndef TASK_DRAIN_BUDGET_CYCLES
+#define TASK_DRAIN_BUDGET_CYCLES    0
+#endif
+
+// Statistik mode drain
+typedef struct {
+    uint32_t batches;           // Panggilan task_scheduler_run yang menjalankan >= 1 task
+    uint32_t tasks;             // Total task yang dijalankan
+    uint32_t max_batch;         // Task terbanyak dalam satu panggilan
+    uint32_t max_cycles;        // Durasi batch terlama
+    uint32_t budget_exhausted;  // Batch yang berhenti karena budget habis, antrian belum kosong
+} task_drain_stats_t;
+
+// --- Primitif coroutine ---
+// Contoh:
+//   task_co_status_t blink_co(task_t *self) {
+//       TASK_CO_BEGIN(self);
+//       led_on();
+//       TASK_CO_AWAIT_MS(self, 100);
+//       led_off();
+//       TASK_CO_END(self);
+//   }
+#define TASK_CO_BEGIN(self)         switch ((self)->co_line) { case 0:
+#define TASK_CO_END(self)           } (self)->co_line = 0; return TASK_CO_ENDED
+
+#define TASK_CO_YIELD(self)                                         \
+    do {                                                            \
+        (self)->co_line = __LINE__; return TASK_CO_YIELDED;         \
+        case __LINE__:;                                             \
+    } while (0)
+
+#define TASK_CO_AWAIT_MS(self, ms)                                  \
+    do {                                                            \
+        (self)->co_wait_ms = (ms);                                  \
+        (self)->co_line = __LINE__; return TASK_CO_WAITING;         \
+        case __LINE__:;                                             \
+    } while (0)
+
+// Kondisi dicek ulang setiap tick (1 ms) sampai terpenuhi
+#define TASK_CO_AWAIT_UNTIL(self, cond)                             \
+    do {                                                            \
+        (self)->co_line = __LINE__;                                 \
+        case __LINE__:                                              \
+        if (!(cond)) { (self)->co_wait_ms = 1; return TASK_CO_WAITING; } \
+    } while (0)
+
+// Tunggu semaphore (di-set ISR atau task lain) lalu ambil
+#define TASK_CO_AWAIT_SEM(self, sem)                                \
+    do {                                                            \
+        TASK_CO_AWAIT_UNTIL(self, *(sem) != 0);                     \
+        *(sem) = 0;                                                 \
+    } while (0)
+
+// Tunggu salah satu bit 'mask' lewat task_post_event; timeout_ms 0 = tanpa batas.
+// Setelah lanjut, task_current_events() berisi bit yang diterima (0 = timeout).
+#define TASK_CO_AWAIT_EVENT(self, mask, timeout_ms)                 \
+    do {                                                            \
+        (self)->event_mask = (mask);                                \
+        (self)->co_wait_ms = (timeout_ms);                          \
+        (self)->co_line = __LINE__; return TASK_CO_WAITING;         \
+        case __LINE__:                                              \
+        (self)->event_mask = 0;                                     \
+    } while (0)
+
+// --- Tabel task statis ---
+// Set task periodik ditentukan saat compile: callback, interval dan prioritas dibaca
+// langsung dari tabel const di flash, RAM hanya menyimpan state runtime (task_static_t).
+//   #define APP_TASKS(X)  X(display, display_task, 100, TASK_PRIORITY_NORMAL)  X(led, led_task, 500, TASK_PRIORITY_LOW)
+//   TASK_TABLE_DEFINE(APP_TASKS);
+//   ...
+//   TASK_TABLE_START(APP_TASKS);       // setelah delay_init()
+//   task_suspend_by_id(TASK_ID_led);
+// Entri ke-i punya ID TASK_STATIC_ID(i), di luar rentang ID task dinamis. Task statis
+// tidak memakai slot _tasks[] dan tidak bisa di-stop (hanya suspend/resume).
+// Kebijakan overrun selalu TASK_OVERRUN_SKIP. Di antara task siap dengan prioritas sama,
+// task statis dijalankan lebih dulu, urut sesuai tabel.
+typedef struct {
+    const char *name;
+    void (*cb)(void);
+    uint32_t interval_ms;
+    task_priority_t priority;
+} task_def_t;
+
+typedef struct {
+    uint32_t deadline_ms;       // Rilis berikutnya (waktu absolut)
+    uint32_t release_ms;        // Rilis yang sedang antri/berjalan
+    uint32_t prev_release_ms;
+    volatile uint32_t overruns; // Rilis yang jatuh saat task masih antri (hanya ditulis ISR)
+#if TASK_PROFILER_ENABLE
+    task_stats_t stats;
+#endif
+} task_static_t;
+
+#define TASK_TABLE_MAX          32      // Satu bit per entri di bitmap siap
+#define TASK_STATIC_ID_BASE     0xFF00U
+#define TASK_STATIC_ID(index)   ((uint16_t)(TASK_STATIC_ID_BASE + (index)))
+
+#define TASK_TABLE_ID_(name, cb, interval_ms, priority)     TASK_ID_##name,
+#define TASK_TABLE_COUNT_(name, cb, interval_ms, priority)  + 1
+#define TASK_TABLE_ENTRY_(name, cb, interval_ms, priority)  { #name, (cb), (interval_ms), (priority) },
+// Bit entri di mask prioritas 'p', dirakit saat compile (lihat table##_prio_mask)
+#define TASK_TABLE_BIT_(name, priority, p)                                                  \
+    | ((priority) == (p) ? 1UL << (TASK_ID_##name - TASK_STATIC_ID_BASE) : 0UL)
+#define TASK_TABLE_MASK_LOW_(name, cb, interval_ms, priority)       TASK_TABLE_BIT_(name, priority, TASK_PRIORITY_LOW)
+#define TASK_TABLE_MASK_NORMAL_(name, cb, interval_ms, priority)    TASK_TABLE_BIT_(name, priority, TASK_PRIORITY_NORMAL)
+#define TASK_TABLE_MASK_HIGH_(name, cb, interval_ms, priority)      TASK_TABLE_BIT_(name, priority, TASK_PRIORITY_HIGH)
+#define TASK_TABLE_MASK_CRITICAL_(name, cb, interval_ms, priority)  TASK_TABLE_BIT_(name, priority, TASK_PRIORITY_CRITICAL)
+#define TASK_TABLE_CHECK_(name, cb, interval_ms, priority)                                  \
+    _Static_assert((priority) >= TASK_PRIORITY_LOW && (priority) < TASK_PRIORITY_COUNT,     \
+                   "task " #name ": prioritas tidak valid");                                \
+    _Static_assert((interval_ms) > 0, "task " #name ": interval_ms harus > 0");
+
+#define TASK_TABLE_DEFINE(table)                                                            \
+    enum { TASK_TABLE_ID_BASE_##table = TASK_STATIC_ID(0) - 1, table(TASK_TABLE_ID_)        \
+           table##_COUNT = 0 table(TASK_TABLE_COUNT_) };                                    \
+    table(TASK_TABLE_CHECK_)                                                                \
+    _Static_assert(table##_COUNT > 0, #table ": tabel task kosong");                        \
+    _Static_assert(table##_COUNT <= TASK_TABLE_MAX, #table ": jumlah task melebihi TASK_TABLE_MAX"); \
+    _Static_assert(TASK_PRIORITY_COUNT == 4, "perbarui TASK_TABLE_MASK_*_");               \
+    static const task_def_t table##_defs[] = { table(TASK_TABLE_ENTRY_) };                  \
+    static const uint32_t table##_prio_mask[TASK_PRIORITY_COUNT] = {                        \
+        0UL table(TASK_TABLE_MASK_LOW_), 0UL table(TASK_TABLE_MASK_NORMAL_),                \
+        0UL table(TASK_TABLE_MASK_HIGH_), 0UL table(TASK_TABLE_MASK_CRITICAL_)              \
+    };                                                                                      \
+    static task_static_t table##_state[table##_COUNT]
+
+#define TASK_TABLE_START(table)                                                             \
+    task_table_start(table##_defs, table##_prio_mask, table##_state, table##_COUNT)
+
 // Deklarasi fungsi
 void delay_init(void);
 void delay_us(uint32_t us);
@@ -56,14 +313,21 @@ bool timeout_expired(uint32_t start, uint32_t timeout_ms);
 
 // Task scheduling
 void task_queue_init(void);
-bool task_queue_add(task_t *task);
-task_t* task_queue_get_next(void);
-void task_queue_remove(task_t *task);
+bool task_queue_add(task_t *task);          // Producer: hanya dari SysTick_Handler
+task_t* task_queue_get_next(void);          // Consumer: hanya dari thread (main loop)
+uint16_t task_queue_count(task_priority_t priority);
 
 uint16_t task_start_ex(void (*cb)(void), uint32_t interval_ms, task_priority_t priority, bool oneshot);
 bool task_start_priority(void (*cb)(void), uint32_t interval_ms, task_priority_t priority);
 bool task_start_oneshot_priority(void (*cb)(void), uint32_t delay_ms, task_priority_t priority);
 bool task_start_semaphore_priority(volatile uint8_t *sem, uint32_t interval_ms, task_priority_t priority);
+uint16_t task_start_coroutine(task_co_fn_t co, uint32_t interval_ms, task_priority_t priority);
+uint16_t task_start_event(void (*cb)(void), uint32_t event_mask, uint32_t timeout_ms, task_priority_t priority);
+bool task_table_start(const task_def_t *defs, const uint32_t *prio_mask, task_static_t *state, uint16_t count);  // Satu tabel, lihat TASK_TABLE_START
+
+// Event: task_post_event aman dipanggil dari ISR mana pun (juga dari thread)
+bool task_post_event(uint16_t task_id, uint32_t mask);
+uint32_t task_current_events(void);         // Event yang membangunkan task sekarang, 0 = timeout
 
 bool task_suspend_by_callback(void (*cb)(void));
 bool task_resume_by_callback(void (*cb)(void));
@@ -75,5 +339,28 @@ bool task_stop_by_id(uint16_t task_id);
 
 uint8_t get_active_task_count(void);
 void task_scheduler_run(void);
+void task_scheduler_idle(void);             // Pengganti __WFI() di main loop
+void task_scheduler_set_drain_budget(uint32_t cycles);  // 0 = satu task per panggilan
+void task_get_drain_stats(task_drain_stats_t *stats);
+void task_reset_drain_stats(void);
+
+// Overrun / periode aktual
+bool task_set_overrun_policy(uint16_t task_id, task_overrun_policy_t policy);
+uint32_t task_get_missed_activations(uint16_t task_id);
+uint32_t task_current_period_ms(void);      // Jarak rilis aktual task yang sedang berjalan
+uint16_t task_current_activations(void);    // > 1 jika aktivasi digabung (COALESCE)
+
+// Profiler
+bool task_set_name(uint16_t task_id, const char *name);
+bool task_get_stats(uint16_t task_id, task_stats_t *stats);
+void task_reset_stats(uint16_t task_id);    // INVALID_TASK_ID (0xFFFF) = semua task
+void task_stats_dump(void (*print)(const char *line));
+uint16_t task_stats_start_dump(void (*print)(const char *line), uint32_t interval_ms);
+
+void delay_set_tickless(bool enable);
+void delay_get_tickless_stats(tickless_stats_t *stats);
+
+void delay_get_isr_stats(systick_isr_stats_t *stats);
+void delay_reset_isr_stats(void);
 
 #endif
\ No newline at end of file
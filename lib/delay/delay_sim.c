@@ -0,0 +1,362 @@
+#ifdef DELAY_HOST_SIM
+
+#include "delay.h"
+#include <string.h>
+
+// --- State waktu virtual ---
+SysTick_Type delay_sim_systick;
+SCB_Type delay_sim_scb;
+DWT_Type delay_sim_dwt;
+CoreDebug_Type delay_sim_coredebug;
+uint32_t SystemCoreClock = 108000000;
+
+static uint64_t sim_now = 0;            // Siklus sejak delay_sim_reset
+static uint64_t sim_next_tick = 0;      // Siklus wrap SysTick berikutnya
+static uint32_t sim_primask = 0;
+static bool sim_in_isr = false;
+static bool sim_tick_pending = false;
+
+typedef struct {
+    void (*handler)(void);
+    uint64_t period;
+    uint64_t next;
+    bool pending;
+} sim_irq_t;
+
+static sim_irq_t sim_irqs[DELAY_SIM_MAX_IRQ];
+static uint8_t sim_irq_count = 0;
+
+// --- Timeline ---
+#define SIM_MAX_TRACKED_TASKS 64
+
+typedef struct {
+    delay_sim_task_stats_t stats;
+    uint64_t release_at;
+    uint64_t start_at;
+    bool released;
+} sim_task_track_t;
+
+static sim_task_track_t sim_tracks[SIM_MAX_TRACKED_TASKS];
+static uint8_t sim_track_count = 0;
+static FILE *sim_trace_out = NULL;
+
+static inline uint64_t sim_us_to_cycles(uint64_t us) {
+    return us * (SystemCoreClock / 1000000);
+}
+
+static inline uint64_t sim_tick_period(void) {
+    return (uint64_t)delay_sim_systick.LOAD + 1;
+}
+
+static void sim_sync_registers(void) {
+    delay_sim_dwt.CYCCNT = (uint32_t)sim_now;
+    // VAL = siklus sampai counter mencapai 0 (tick); tepat di tick counter bernilai 0
+    if (delay_sim_systick.CTRL & SysTick_CTRL_ENABLE_Msk) {
+        uint64_t left = sim_next_tick - sim_now;
+        delay_sim_systick.VAL = (uint32_t)(left < sim_tick_period() ? left : 0);
+    }
+    if (sim_tick_pending) {
+        delay_sim_scb.ICSR |= SCB_ICSR_PENDSTSET_Msk;
+    } else {
+        delay_sim_scb.ICSR &= ~SCB_ICSR_PENDSTSET_Msk;
+    }
+}
+
+// Jalankan semua interupsi pending jika PRIMASK mengizinkan (tanpa nesting)
+static void sim_dispatch_pending(void) {
+    if (sim_primask != 0 || sim_in_isr) {
+        return;
+    }
+
+    sim_in_isr = true;
+    bool again = true;
+    while (again) {
+        again = false;
+        if (sim_tick_pending) {
+            sim_tick_pending = false;
+            sim_sync_registers();
+            SysTick_Handler();
+            again = true;
+        }
+        for (uint8_t i = 0; i < sim_irq_count; i++) {
+            if (sim_irqs[i].pending) {
+                sim_irqs[i].pending = false;
+                sim_irqs[i].handler();
+                again = true;
+            }
+        }
+    }
+    sim_in_isr = false;
+    sim_sync_registers();
+}
+
+static bool sim_irq_pending(void) {
+    if (sim_tick_pending) {
+        return true;
+    }
+    for (uint8_t i = 0; i < sim_irq_count; i++) {
+        if (sim_irqs[i].pending) {
+            return true;
+        }
+    }
+    return false;
+}
+
+// Siklus absolut event interupsi terdekat
+static uint64_t sim_next_event(void) {
+    uint64_t next = UINT64_MAX;
+    if ((delay_sim_systick.CTRL & SysTick_CTRL_ENABLE_Msk) && sim_next_tick < next) {
+        next = sim_next_tick;
+    }
+    for (uint8_t i = 0; i < sim_irq_count; i++) {
+        if (sim_irqs[i].next < next) {
+            next = sim_irqs[i].next;
+        }
+    }
+    return next;
+}
+
+// Majukan waktu ke 'target', interupsi yang jatuh tempo menyela di titiknya
+static void sim_advance_to(uint64_t target) {
+    while (sim_now < target) {
+        uint64_t next = sim_next_event();
+        if (next > target) {
+            sim_now = target;
+            break;
+        }
+
+        sim_now = next;
+        if ((delay_sim_systick.CTRL & SysTick_CTRL_ENABLE_Msk) && sim_next_tick == next) {
+            sim_next_tick += sim_tick_period();
+            delay_sim_systick.CTRL |= SysTick_CTRL_COUNTFLAG_Msk;
+            if (delay_sim_systick.CTRL & SysTick_CTRL_TICKINT_Msk) {
+                sim_tick_pending = true;
+            }
+        }
+        for (uint8_t i = 0; i < sim_irq_count; i++) {
+            if (sim_irqs[i].next == next) {
+                sim_irqs[i].next += sim_irqs[i].period;
+                sim_irqs[i].pending = true;
+            }
+        }
+        sim_dispatch_pending();
+    }
+    sim_sync_registers();
+}
+
+// --- Pengganti gd32f3x0.h / CMSIS ---
+void SystemInit(void) {
+}
+
+uint32_t rcu_clock_freq_get(rcu_clock_freq_enum clock) {
+    (void)clock;
+    return SystemCoreClock;
+}
+
+uint32_t SysTick_Config(uint32_t ticks) {
+    if (ticks == 0 || (ticks - 1) > SysTick_LOAD_RELOAD_Msk) {
+        return 1;
+    }
+    delay_sim_systick.LOAD = ticks - 1;
+    delay_sim_systick.CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk | SysTick_CTRL_ENABLE_Msk;
+    sim_next_tick = sim_now + ticks;
+    sim_sync_registers();
+    return 0;
+}
+
+// Counter berhenti di nilainya sekarang; COUNTFLAG tidak ikut ter-clear
+void delay_sim_systick_stop(void) {
+    sim_sync_registers();
+    delay_sim_systick.CTRL = SysTick_CTRL_CLKSOURCE_Msk | SysTick_CTRL_TICKINT_Msk |
+                             (delay_sim_systick.CTRL & SysTick_CTRL_COUNTFLAG_Msk);
+}
+
+// Dari 0 counter memuat LOAD dulu (satu periode penuh)
+void delay_sim_systick_resume(void) {
+    uint32_t val = delay_sim_systick.VAL;
+    delay_sim_systick.CTRL |= SysTick_CTRL_ENABLE_Msk;
+    sim_next_tick = sim_now + ((val > 0) ? val : sim_tick_period());
+    sim_sync_registers();
+}
+
+// Tulis VAL meng-clear counter dan COUNTFLAG; 'load' dimuat pada siklus berikutnya
+void delay_sim_systick_restart(uint32_t load) {
+    delay_sim_systick.LOAD = load;
+    delay_sim_systick.CTRL &= ~SysTick_CTRL_COUNTFLAG_Msk;
+    delay_sim_systick.CTRL |= SysTick_CTRL_ENABLE_Msk;
+    sim_next_tick = sim_now + (uint64_t)load + 1;
+    sim_sync_registers();
+}
+
+uint32_t __get_PRIMASK(void) {
+    return sim_primask;
+}
+
+void __set_PRIMASK(uint32_t primask) {
+    sim_primask = primask;
+    sim_dispatch_pending();
+}
+
+void __disable_irq(void) {
+    sim_primask = 1;
+}
+
+void __enable_irq(void) {
+    __set_PRIMASK(0);
+}
+
+// Bangun oleh interupsi berikutnya; dengan PRIMASK aktif handler menunggu critical_exit
+void __WFI(void) {
+    if (sim_irq_pending()) {
+        return;
+    }
+    uint64_t next = sim_next_event();
+    if (next == UINT64_MAX) {
+        return;     // Tidak ada sumber interupsi: jangan macet
+    }
+    sim_advance_to(next);
+}
+
+void __NOP(void) {
+    sim_advance_to(sim_now + 1);
+}
+
+// --- API simulasi ---
+void delay_sim_reset(uint32_t core_hz) {
+    SystemCoreClock = core_hz;
+    sim_now = 0;
+    sim_next_tick = 0;
+    sim_primask = 0;
+    sim_in_isr = false;
+    sim_tick_pending = false;
+    sim_irq_count = 0;
+    sim_track_count = 0;
+    memset(&delay_sim_systick, 0, sizeof(delay_sim_systick));
+    memset(&delay_sim_scb, 0, sizeof(delay_sim_scb));
+    memset(&delay_sim_dwt, 0, sizeof(delay_sim_dwt));
+    memset(&delay_sim_coredebug, 0, sizeof(delay_sim_coredebug));
+    memset(sim_irqs, 0, sizeof(sim_irqs));
+    memset(sim_tracks, 0, sizeof(sim_tracks));
+}
+
+uint64_t delay_sim_cycles(void) {
+    return sim_now;
+}
+
+uint64_t delay_sim_time_us(void) {
+    return sim_now / (SystemCoreClock / 1000000);
+}
+
+void delay_sim_consume_cycles(uint64_t cycles) {
+    sim_advance_to(sim_now + cycles);
+}
+
+void delay_sim_consume_us(uint32_t us) {
+    delay_sim_consume_cycles(sim_us_to_cycles(us));
+}
+
+bool delay_sim_add_periodic_irq(uint32_t period_us, uint32_t offset_us, void (*handler)(void)) {
+    if (handler == NULL || period_us == 0 || sim_irq_count >= DELAY_SIM_MAX_IRQ) {
+        return false;
+    }
+    sim_irq_t *irq = &sim_irqs[sim_irq_count++];
+    irq->handler = handler;
+    irq->period = sim_us_to_cycles(period_us);
+    irq->next = sim_now + sim_us_to_cycles(offset_us > 0 ? offset_us : period_us);
+    irq->pending = false;
+    return true;
+}
+
+void delay_sim_set_trace(FILE *out) {
+    sim_trace_out = out;
+    if (out != NULL) {
+        fprintf(out, "time_us,event,task_id,priority,latency_us\n");
+    }
+}
+
+static sim_task_track_t* sim_track_find(uint16_t task_id, bool create) {
+    for (uint8_t i = 0; i < sim_track_count; i++) {
+        if (sim_tracks[i].stats.task_id == task_id) {
+            return &sim_tracks[i];
+        }
+    }
+    if (!create || sim_track_count >= SIM_MAX_TRACKED_TASKS) {
+        return NULL;
+    }
+    sim_task_track_t *track = &sim_tracks[sim_track_count++];
+    memset(track, 0, sizeof(*track));
+    track->stats.task_id = task_id;
+    return track;
+}
+
+void delay_sim_trace(delay_sim_event_t event, uint16_t task_id, uint8_t priority) {
+    static const char *const names[] = {"release", "start", "end"};
+    sim_task_track_t *track = sim_track_find(task_id, true);
+    uint64_t cycles = 0;
+
+    if (track != NULL) {
+        switch (event) {
+            case DELAY_SIM_EV_RELEASE:
+                // Rilis ganda sebelum dijalankan: latensi dihitung dari rilis pertama
+                if (!track->released) {
+                    track->release_at = sim_now;
+                    track->released = true;
+                }
+                track->stats.releases++;
+                break;
+
+            case DELAY_SIM_EV_START:
+                if (track->released) {
+                    cycles = sim_now - track->release_at;
+                    track->released = false;
+                }
+                track->start_at = sim_now;
+                track->stats.runs++;
+                track->stats.latency_total_cycles += cycles;
+                if (cycles > track->stats.latency_max_cycles) track->stats.latency_max_cycles = cycles;
+                break;
+
+            case DELAY_SIM_EV_END:
+                cycles = sim_now - track->start_at;
+                track->stats.exec_total_cycles += cycles;
+                if (cycles > track->stats.exec_max_cycles) track->stats.exec_max_cycles = cycles;
+                cycles = 0;
+                break;
+        }
+    }
+
+    if (sim_trace_out != NULL) {
+        uint32_t per_us = SystemCoreClock / 1000000;
+        fprintf(sim_trace_out, "%llu,%s,%u,%u,%llu\n",
+                (unsigned long long)(sim_now / per_us), names[event], task_id, priority,
+                (unsigned long long)(cycles / per_us));
+    }
+}
+
+bool delay_sim_get_task_stats(uint16_t task_id, delay_sim_task_stats_t *stats) {
+    sim_task_track_t *track = sim_track_find(task_id, false);
+    if (track == NULL || stats == NULL) {
+        return false;
+    }
+    *stats = track->stats;
+    return true;
+}
+
+void delay_sim_print_summary(FILE *out) {
+    uint32_t per_us = SystemCoreClock / 1000000;
+    fprintf(out, "sim time %llu us\n", (unsigned long long)(sim_now / per_us));
+    fprintf(out, "%6s %8s %8s %12s %12s %12s %12s\n",
+            "id", "release", "run", "lat_avg_us", "lat_max_us", "exec_avg_us", "exec_max_us");
+    for (uint8_t i = 0; i < sim_track_count; i++) {
+        const delay_sim_task_stats_t *s = &sim_tracks[i].stats;
+        uint64_t runs = (s->runs > 0) ? s->runs : 1;
+        fprintf(out, "%6u %8lu %8lu %12llu %12llu %12llu %12llu\n",
+                s->task_id, (unsigned long)s->releases, (unsigned long)s->runs,
+                (unsigned long long)(s->latency_total_cycles / runs / per_us),
+                (unsigned long long)(s->latency_max_cycles / per_us),
+                (unsigned long long)(s->exec_total_cycles / runs / per_us),
+                (unsigned long long)(s->exec_max_cycles / per_us));
+    }
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,143 @@
+#ifndef DELAY_SIM_H
+#define DELAY_SIM_H
+
+// Port simulasi host untuk lib/delay (aktif hanya dengan -DDELAY_HOST_SIM).
+// Menggantikan gd32f3x0.h: SysTick, DWT, PRIMASK dan WFI dijalankan di atas waktu
+// virtual (siklus CPU) yang hanya maju lewat fungsi di bawah ini, sehingga hasilnya
+// deterministik. Contoh pemakaian: examples/sim_bckp/sim_bckp.c
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stdio.h>
+
+// --- Register core (subset yang dipakai delay.c) ---
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t LOAD;
+    volatile uint32_t VAL;
+    volatile uint32_t CALIB;
+} SysTick_Type;
+
+typedef struct {
+    volatile uint32_t ICSR;
+} SCB_Type;
+
+typedef struct {
+    volatile uint32_t CTRL;
+    volatile uint32_t CYCCNT;
+} DWT_Type;
+
+typedef struct {
+    volatile uint32_t DEMCR;
+} CoreDebug_Type;
+
+extern SysTick_Type delay_sim_systick;
+extern SCB_Type delay_sim_scb;
+extern DWT_Type delay_sim_dwt;
+extern CoreDebug_Type delay_sim_coredebug;
+extern uint32_t SystemCoreClock;
+
+#define SysTick     (&delay_sim_systick)
+#define SCB         (&delay_sim_scb)
+#define DWT         (&delay_sim_dwt)
+#define CoreDebug   (&delay_sim_coredebug)
+
+#define SysTick_CTRL_ENABLE_Msk     (1UL << 0)
+#define SysTick_CTRL_TICKINT_Msk    (1UL << 1)
+#define SysTick_CTRL_CLKSOURCE_Msk  (1UL << 2)
+#define SysTick_CTRL_COUNTFLAG_Msk  (1UL << 16)
+#define SysTick_LOAD_RELOAD_Msk     (0xFFFFFFUL)
+#define SCB_ICSR_PENDSTSET_Msk      (1UL << 26)
+#define DWT_CTRL_CYCCNTENA_Msk      (1UL << 0)
+#define CoreDebug_DEMCR_TRCENA_Msk  (1UL << 24)
+
+typedef enum {
+    CK_SYS,
+    CK_AHB,
+    CK_APB1,
+    CK_APB2
+} rcu_clock_freq_enum;
+
+void SystemInit(void);
+uint32_t rcu_clock_freq_get(rcu_clock_freq_enum clock);
+uint32_t SysTick_Config(uint32_t ticks);
+void SysTick_Handler(void);
+
+// --- Intrinsik ---
+uint32_t __get_PRIMASK(void);
+void __set_PRIMASK(uint32_t primask);
+void __disable_irq(void);
+void __enable_irq(void);
+void __WFI(void);
+void __NOP(void);               // Maju 1 siklus (loop busy-wait delay_us)
+
+// -DDELAY_SIM_PREEMPT_BARRIERS: setiap DMB juga maju 1 siklus, jadi interupsi bisa
+// menyela di tengah operasi ring SPSC (dipakai stress test di test/)
+#ifdef DELAY_SIM_PREEMPT_BARRIERS
+static inline void __DMB(void) { __sync_synchronize(); __NOP(); }
+#else
+static inline void __DMB(void) { __sync_synchronize(); }
+#endif
+static inline void __DSB(void) { __sync_synchronize(); }
+static inline void __ISB(void) { }
+
+// Simulasi single-core: STREX selalu berhasil
+static inline uint32_t __LDREXW(volatile uint32_t *addr) { return *addr; }
+static inline uint32_t __STREXW(uint32_t value, volatile uint32_t *addr) { *addr = value; return 0; }
+
+// --- Hook trace dari delay.c ---
+typedef enum {
+    DELAY_SIM_EV_RELEASE,       // Task masuk antrian siap
+    DELAY_SIM_EV_START,         // Task mulai dijalankan
+    DELAY_SIM_EV_END            // Task selesai
+} delay_sim_event_t;
+
+void delay_sim_trace(delay_sim_event_t event, uint16_t task_id, uint8_t priority);
+
+#define DELAY_TRACE_RELEASE(task)   delay_sim_trace(DELAY_SIM_EV_RELEASE, (task)->task_id, (uint8_t)(task)->priority)
+#define DELAY_TRACE_START(task)     delay_sim_trace(DELAY_SIM_EV_START, (task)->task_id, (uint8_t)(task)->priority)
+#define DELAY_TRACE_END(task_id, priority) delay_sim_trace(DELAY_SIM_EV_END, (task_id), (uint8_t)(priority))
+#define DELAY_TRACE_STATIC_RELEASE(task_id, priority) delay_sim_trace(DELAY_SIM_EV_RELEASE, (task_id), (uint8_t)(priority))
+#define DELAY_TRACE_STATIC_START(task_id, priority) delay_sim_trace(DELAY_SIM_EV_START, (task_id), (uint8_t)(priority))
+
+// Tulisan SysTick di tickless idle: simulator harus tahu kapan counter dihentikan,
+// dilanjutkan atau di-reset (register biasa tidak bisa mencegat tulisan)
+void delay_sim_systick_stop(void);
+void delay_sim_systick_resume(void);
+void delay_sim_systick_restart(uint32_t load);
+
+#define DELAY_SYSTICK_STOP()        delay_sim_systick_stop()
+#define DELAY_SYSTICK_RESUME()      delay_sim_systick_resume()
+#define DELAY_SYSTICK_RESTART(load) delay_sim_systick_restart(load)
+
+// --- API simulasi ---
+#define DELAY_SIM_MAX_IRQ   4
+
+// Statistik per task dari timeline
+typedef struct {
+    uint16_t task_id;
+    uint32_t releases;
+    uint32_t runs;
+    uint64_t latency_max_cycles;    // Rilis -> mulai
+    uint64_t latency_total_cycles;
+    uint64_t exec_max_cycles;       // Mulai -> selesai (termasuk preempsi ISR)
+    uint64_t exec_total_cycles;
+} delay_sim_task_stats_t;
+
+void delay_sim_reset(uint32_t core_hz);         // Panggil sebelum delay_init()
+uint64_t delay_sim_cycles(void);
+uint64_t delay_sim_time_us(void);
+
+// Biaya eksekusi: panggil dari callback task; SysTick/IRQ tetap menyela
+void delay_sim_consume_cycles(uint64_t cycles);
+void delay_sim_consume_us(uint32_t us);
+
+// Sumber interupsi periodik (misalnya DMA ADC), handler dipanggil dalam konteks ISR
+bool delay_sim_add_periodic_irq(uint32_t period_us, uint32_t offset_us, void (*handler)(void));
+
+// Timeline CSV: time_us,event,task_id,priority,latency_us (NULL = mati)
+void delay_sim_set_trace(FILE *out);
+bool delay_sim_get_task_stats(uint16_t task_id, delay_sim_task_stats_t *stats);
+void delay_sim_print_summary(FILE *out);
+
+#endif
\ No newline at end of file
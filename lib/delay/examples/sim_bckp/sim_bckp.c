@@ -0,0 +1,83 @@
+// Replay set task src/bckp di atas waktu virtual (tanpa board).
+//
+// Build & jalankan dari root repo:
+//   gcc -O2 -DDELAY_HOST_SIM -Ilib/delay -o sim_bckp lib/delay/delay.c lib/delay/delay_sim.c lib/delay/examples/sim_bckp/sim_bckp.c
+//   ./sim_bckp [detik] [timeline.csv]
+//
+// Biaya eksekusi di bawah adalah perkiraan; ganti dengan hasil task_stats_dump()
+// dari board untuk replay yang lebih akurat.
+
+#include "delay.h"
+#include <stdio.h>
+#include <stdlib.h>
+
+#define CONTROL_EVENT_ADC   (1UL << 0)
+
+#define COST_CONTROL_US     120     // Fuzzy PID + konversi ADC
+#define COST_DISPLAY_US     300     // HT1621 bit-bang
+#define COST_LCD_US         4000    // I2C 100 kHz, 2 baris
+#define COST_LED_US         2
+
+static uint16_t control_id;
+static uint16_t adc_scans;
+
+// Pengganti DMA_Channel0_IRQHandler: scan ADC tiap lembah PWM 5 kHz
+static void adc_dma_irq(void) {
+    if (++adc_scans >= 25) {
+        adc_scans = 0;
+        task_post_event(control_id, CONTROL_EVENT_ADC);
+    }
+}
+
+static void control_task(void)    { delay_sim_consume_us(COST_CONTROL_US); }
+static void display_task(void)    { delay_sim_consume_us(COST_DISPLAY_US); }
+static void lcd_update_task(void) { delay_sim_consume_us(COST_LCD_US); }
+static void led_blink_task(void)  { delay_sim_consume_us(COST_LED_US); }
+
+static void print_line(const char *line) {
+    puts(line);
+}
+
+int main(int argc, char **argv) {
+    uint32_t seconds = (argc > 1) ? (uint32_t)atoi(argv[1]) : 10;
+    FILE *trace = NULL;
+    if (argc > 2) {
+        trace = fopen(argv[2], "w");
+        if (trace == NULL) {
+            perror(argv[2]);
+            return 1;
+        }
+    }
+
+    delay_sim_reset(108000000);
+    delay_sim_set_trace(trace);
+    delay_init();
+
+    control_id = task_start_event(control_task, CONTROL_EVENT_ADC, 10, TASK_PRIORITY_HIGH);
+    task_set_name(control_id, "control");
+    task_set_name(task_start_ex(display_task, 100, TASK_PRIORITY_NORMAL, false), "display");
+    task_set_name(task_start_ex(lcd_update_task, 200, TASK_PRIORITY_NORMAL, false), "lcd");
+    task_set_name(task_start_ex(led_blink_task, 500, TASK_PRIORITY_LOW, false), "led");
+    task_scheduler_set_drain_budget(SystemCoreClock / 2000);
+    delay_sim_add_periodic_irq(200, 0, adc_dma_irq);
+
+    uint64_t end_us = (uint64_t)seconds * 1000000;
+    while (delay_sim_time_us() < end_us) {
+        task_scheduler_run();
+        task_scheduler_idle();
+    }
+
+    delay_sim_print_summary(stdout);
+    task_stats_dump(print_line);
+
+    task_drain_stats_t drain;
+    task_get_drain_stats(&drain);
+    printf("drain: batches=%lu tasks=%lu max_batch=%lu budget_exhausted=%lu\n",
+           (unsigned long)drain.batches, (unsigned long)drain.tasks,
+           (unsigned long)drain.max_batch, (unsigned long)drain.budget_exhausted);
+
+    if (trace != NULL) {
+        fclose(trace);
+    }
+    return 0;
+}
@@ -0,0 +1,80 @@
+// Benchmark host fuzzy_pid_update: permukaan gain (FUZZY_PID_SURFACE=1) vs inferensi
+// aturan asli (FUZZY_PID_SURFACE=0). Kedua build memakai deret input yang sama (PRNG
+// tetap), jadi checksum output juga menunjukkan selisih kedua jalur.
+//
+// Build & jalankan dari root repo (sekali per jalur):
+//   gcc -O2 -DFUZZY_PID_HOST -DFUZZY_PID_SURFACE=1 -Ilib/fuzzy_pid -Ilib/qmath -o bench_surface
+//       lib/fuzzy_pid/examples/bench_surface/bench_surface.c lib/fuzzy_pid/fuzzy_pid.c -lm
+//   ./bench_surface
+//   (ulangi dengan -DFUZZY_PID_SURFACE=0 -o bench_rules)
+//
+// Angka host hanya perbandingan relatif; di target, waktu task kontrol dibaca dari
+// profiler task (task_stats_dump).
+
+#include "fuzzy_pid.h"
+#include <stdio.h>
+#include <time.h>
+
+#define BENCH_INPUTS        4096
+#define BENCH_ROUNDS        500
+#define BENCH_SETPOINT      350.0f
+
+static float feedback[BENCH_INPUTS];
+
+// xorshift32, deret sama di setiap build
+static uint32_t bench_rng = 0x2545F491u;
+
+static float bench_uniform(void) {
+    bench_rng ^= bench_rng << 13;
+    bench_rng ^= bench_rng >> 17;
+    bench_rng ^= bench_rng << 5;
+    return (float)(bench_rng >> 8) * (2.0f / 16777216.0f) - 1.0f;   // -1..1
+}
+
+static double bench_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1e9 + ts.tv_nsec;
+}
+
+static void bench_mode(fuzzy_mode_t mode, const char *name) {
+    fuzzy_pid_t fp;
+    double checksum = 0.0;
+    double best_ns = 1e30;
+
+    for (int round = 0; round < BENCH_ROUNDS; round++) {
+        fuzzy_pid_init(&fp, mode);
+        fuzzy_pid_set_setpoint(&fp, BENCH_SETPOINT);
+        double start = bench_now_ns();
+        for (int i = 0; i < BENCH_INPUTS; i++) {
+            fp.feedback = feedback[i];
+            float out = fuzzy_pid_update(&fp);
+            if (round == 0) {
+                checksum += out;
+            }
+        }
+        double ns = (bench_now_ns() - start) / BENCH_INPUTS;
+        if (ns < best_ns) {
+            best_ns = ns;
+        }
+    }
+    printf("%-8s %s: %.1f ns per fuzzy_pid_update (checksum %.3f)\n",
+           name, FUZZY_PID_SURFACE ? "surface" : "rules  ", best_ns, checksum);
+}
+
+int main(void) {
+    // Random walk di sekitar setpoint (+-10 %) dengan lompatan sesekali:
+    // mencakup seluruh bidang (e, de) termasuk tepi saturasi
+    float t = BENCH_SETPOINT;
+    for (int i = 0; i < BENCH_INPUTS; i++) {
+        t += bench_uniform() * 2.0f;
+        if ((i % 64) == 0) {
+            t = BENCH_SETPOINT * (1.0f + 0.1f * bench_uniform());
+        }
+        feedback[i] = t;
+    }
+
+    bench_mode(MODE_SOLDER_T12, "T12");
+    bench_mode(MODE_HOT_AIR, "hot air");
+    return 0;
+}
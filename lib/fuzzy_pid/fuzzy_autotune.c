@@ -0,0 +1,139 @@
+#include "fuzzy_autotune.h"
+#include <math.h>
+
+void fuzzy_autotune_start(fuzzy_autotune_t *at, fuzzy_mode_t mode, float setpoint) {
+    at->mode = mode;
+    at->setpoint = setpoint;
+    if (mode == MODE_SOLDER_T12) {
+        at->high = FUZZY_AUTOTUNE_T12_HIGH;
+        at->hysteresis = FUZZY_AUTOTUNE_T12_HYST_C;
+    } else {
+        at->high = FUZZY_AUTOTUNE_HOT_AIR_HIGH;
+        at->hysteresis = FUZZY_AUTOTUNE_HOT_AIR_HYST_C;
+    }
+    at->output = at->high;
+    at->elapsed_s = 0.0f;
+    at->cycle_start_s = 0.0f;
+    at->temp_max = 0.0f;
+    at->temp_min = 0.0f;
+    at->cycles_seen = 0;
+    at->cycles = 0;
+    at->sum_period_s = 0.0f;
+    at->sum_amplitude = 0.0f;
+    at->ku = 0.0f;
+    at->tu_s = 0.0f;
+    at->state = FUZZY_AUTOTUNE_HEATUP;
+}
+
+uint8_t fuzzy_autotune_running(const fuzzy_autotune_t *at) {
+    return at->state == FUZZY_AUTOTUNE_HEATUP || at->state == FUZZY_AUTOTUNE_RELAY;
+}
+
+static float fuzzy_autotune_fail(fuzzy_autotune_t *at) {
+    at->state = FUZZY_AUTOTUNE_FAILED;
+    at->output = 0.0f;
+    return 0.0f;
+}
+
+// Siklus lengkap (relay naik ke naik): periode dan amplitudo setengah puncak-ke-puncak
+static void fuzzy_autotune_cycle(fuzzy_autotune_t *at) {
+    float period = at->elapsed_s - at->cycle_start_s;
+    float amplitude = 0.5f * (at->temp_max - at->temp_min);
+
+    if (at->cycles_seen++ >= FUZZY_AUTOTUNE_SKIP_CYCLES) {
+        at->sum_period_s += period;
+        at->sum_amplitude += amplitude;
+        at->cycles++;
+    }
+    if (at->cycles < FUZZY_AUTOTUNE_CYCLES) {
+        return;
+    }
+
+    float a = at->sum_amplitude / at->cycles;
+    float h = at->hysteresis;
+    if (a <= h) {
+        fuzzy_autotune_fail(at);
+        return;
+    }
+    // Fungsi deskripsi relay dengan histeresis
+    at->ku = 4.0f * (0.5f * at->high) / (3.14159265f * sqrtf(a * a - h * h));
+    at->tu_s = at->sum_period_s / at->cycles;
+    at->state = FUZZY_AUTOTUNE_DONE;
+    at->output = 0.0f;
+}
+
+float fuzzy_autotune_step(fuzzy_autotune_t *at, float temp_c, float dt_s) {
+    if (!fuzzy_autotune_running(at)) {
+        return 0.0f;
+    }
+
+    at->elapsed_s += dt_s;
+    if (at->elapsed_s > FUZZY_AUTOTUNE_TIMEOUT_S ||
+        temp_c > at->setpoint + FUZZY_AUTOTUNE_MAX_OVERSHOOT_C) {
+        return fuzzy_autotune_fail(at);
+    }
+
+    if (at->state == FUZZY_AUTOTUNE_HEATUP) {
+        if (temp_c > at->setpoint + at->hysteresis) {
+            // Siklus pertama mulai di relay naik berikutnya
+            at->state = FUZZY_AUTOTUNE_RELAY;
+            at->output = 0.0f;
+            at->temp_max = temp_c;
+            at->temp_min = temp_c;
+            at->cycle_start_s = -1.0f;
+        }
+        return at->output;
+    }
+
+    if (temp_c > at->temp_max) at->temp_max = temp_c;
+    if (temp_c < at->temp_min) at->temp_min = temp_c;
+
+    if (at->output > 0.0f) {
+        if (temp_c > at->setpoint + at->hysteresis) {
+            at->output = 0.0f;
+        }
+    } else if (temp_c < at->setpoint - at->hysteresis) {
+        at->output = at->high;
+        if (at->cycle_start_s >= 0.0f) {
+            fuzzy_autotune_cycle(at);
+        }
+        at->cycle_start_s = at->elapsed_s;
+        at->temp_max = temp_c;
+        at->temp_min = temp_c;
+    }
+    return at->output;
+}
+
+// Rasio terhadap heater referensi. Ki dipakai dua kali di fuzzy_pid (saat integrasi dan
+// di output), jadi gain integral efektif ~ Ki^2 dan skalanya diakar.
+static void fuzzy_autotune_scales(fuzzy_mode_t mode, float ku, float tu_s, float scale[3]) {
+    if (ku <= 0.0f || tu_s <= 0.0f) {
+        scale[0] = scale[1] = scale[2] = 1.0f;
+        return;
+    }
+
+    float ku_ref = (mode == MODE_SOLDER_T12) ? FUZZY_AUTOTUNE_T12_KU_REF : FUZZY_AUTOTUNE_HOT_AIR_KU_REF;
+    float tu_ref = (mode == MODE_SOLDER_T12) ? FUZZY_AUTOTUNE_T12_TU_REF_S : FUZZY_AUTOTUNE_HOT_AIR_TU_REF_S;
+    float ku_ratio = ku / ku_ref;
+    float tu_ratio = tu_s / tu_ref;
+
+    scale[0] = ku_ratio;
+    scale[1] = sqrtf(ku_ratio / tu_ratio);
+    scale[2] = ku_ratio * tu_ratio;
+    for (uint8_t i = 0; i < 3; i++) {
+        scale[i] = fmaxf(FUZZY_AUTOTUNE_SCALE_MIN, fminf(FUZZY_AUTOTUNE_SCALE_MAX, scale[i]));
+    }
+}
+
+void fuzzy_autotune_apply(fuzzy_pid_t *fp, float ku, float tu_s) {
+    float scale[3];
+    fuzzy_autotune_scales(fp->mode, ku, tu_s, scale);
+    fuzzy_pid_set_gain_scale(fp, scale[0], scale[1], scale[2]);
+}
+
+void fuzzy_autotune_apply_q(fuzzy_pid_q_t *fp, float ku, float tu_s) {
+    float scale[3];
+    fuzzy_autotune_scales(fp->mode, ku, tu_s, scale);
+    fuzzy_pid_q_set_gain_scale(fp, q16_from_float(scale[0]), q16_from_float(scale[1]),
+                               q16_from_float(scale[2]));
+}
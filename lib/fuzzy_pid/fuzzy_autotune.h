@@ -0,0 +1,107 @@
+#ifndef FUZZY_AUTOTUNE_H
+#define FUZZY_AUTOTUNE_H
+
+#include <stdint.h>
+#include "fuzzy_pid.h"
+
+// Autotune relay (Astrom-Hagglund): heater di-bang-bang antara 0 dan high di sekitar
+// setpoint dengan histeresis h. Dari amplitudo osilasi a dan periode Tu:
+//   Ku = 4d / (pi * sqrt(a^2 - h^2)),  d = high / 2
+// Ku/Tu dibandingkan dengan heater referensi (tempat matriks fuzzy disetel) lalu menjadi
+// skala gain fuzzy_pid (aturan Ziegler-Nichols: Kp ~ Ku, Ki ~ Ku/Tu, Kd ~ Ku*Tu).
+// Pemanggil menerapkan duty hasil fuzzy_autotune_step ke PWM dan menyimpan Ku/Tu di
+// profil tip (adc_calib_profile_t) agar skala dimuat ulang saat tip dipasang.
+
+// Relay: duty atas (%) dan histeresis (C) per mode
+#ifndef FUZZY_AUTOTUNE_T12_HIGH
+#define FUZZY_AUTOTUNE_T12_HIGH         80.0f   // = T12_MAX_DUTY
+#endif
+#ifndef FUZZY_AUTOTUNE_T12_HYST_C
+#define FUZZY_AUTOTUNE_T12_HYST_C       1.0f
+#endif
+#ifndef FUZZY_AUTOTUNE_HOT_AIR_HIGH
+#define FUZZY_AUTOTUNE_HOT_AIR_HIGH     100.0f
+#endif
+#ifndef FUZZY_AUTOTUNE_HOT_AIR_HYST_C
+#define FUZZY_AUTOTUNE_HOT_AIR_HYST_C   2.0f
+#endif
+
+// Siklus pertama setelah heat-up dibuang (belum periodik), lalu rata-rata N siklus
+#ifndef FUZZY_AUTOTUNE_SKIP_CYCLES
+#define FUZZY_AUTOTUNE_SKIP_CYCLES      1
+#endif
+#ifndef FUZZY_AUTOTUNE_CYCLES
+#define FUZZY_AUTOTUNE_CYCLES           4
+#endif
+
+// Batas keamanan: gagal (relay berhenti) jika lewat waktu atau suhu lewat setpoint + batas.
+// Setelah gagal pemanggil kembali ke PID biasa dengan skala 1 (fuzzy_autotune_apply, ku 0).
+#ifndef FUZZY_AUTOTUNE_TIMEOUT_S
+#define FUZZY_AUTOTUNE_TIMEOUT_S        600.0f
+#endif
+#ifndef FUZZY_AUTOTUNE_MAX_OVERSHOOT_C
+#define FUZZY_AUTOTUNE_MAX_OVERSHOOT_C  40.0f
+#endif
+
+// Ku/Tu heater referensi seperti yang dilaporkan autotune ini (relay dan histeresis di
+// atas, setpoint 350 C). Nilai awal = simulasi autotune pada model termal (T12: 700 C
+// pada 100%, tau 12 s, dead time 0.3 s; hot air: 500 C, tau 25 s, dead time 2 s);
+// sebaiknya diganti dengan hasil autotune pada tip/nozzle saat matriks gain disetel.
+#ifndef FUZZY_AUTOTUNE_T12_KU_REF
+#define FUZZY_AUTOTUNE_T12_KU_REF       6.4f    // % daya per C
+#endif
+#ifndef FUZZY_AUTOTUNE_T12_TU_REF_S
+#define FUZZY_AUTOTUNE_T12_TU_REF_S     1.4f
+#endif
+#ifndef FUZZY_AUTOTUNE_HOT_AIR_KU_REF
+#define FUZZY_AUTOTUNE_HOT_AIR_KU_REF   3.0f
+#endif
+#ifndef FUZZY_AUTOTUNE_HOT_AIR_TU_REF_S
+#define FUZZY_AUTOTUNE_HOT_AIR_TU_REF_S 9.0f
+#endif
+
+// Batas skala gain hasil autotune
+#define FUZZY_AUTOTUNE_SCALE_MIN        0.25f
+#define FUZZY_AUTOTUNE_SCALE_MAX        4.0f
+
+typedef enum {
+    FUZZY_AUTOTUNE_IDLE,
+    FUZZY_AUTOTUNE_HEATUP,      // Relay atas sampai setpoint + histeresis
+    FUZZY_AUTOTUNE_RELAY,       // Osilasi, siklus diukur
+    FUZZY_AUTOTUNE_DONE,        // ku dan tu_s valid
+    FUZZY_AUTOTUNE_FAILED       // Timeout, overshoot, atau amplitudo <= histeresis
+} fuzzy_autotune_state_t;
+
+typedef struct {
+    fuzzy_autotune_state_t state;
+    fuzzy_mode_t mode;
+    float setpoint;
+    float high;                 // Duty relay atas (%)
+    float hysteresis;           // C
+    float output;               // Duty terakhir (%)
+
+    float elapsed_s;
+    float cycle_start_s;        // Saat relay terakhir naik (awal siklus)
+    float temp_max;             // Puncak siklus berjalan
+    float temp_min;
+    uint8_t cycles_seen;        // Siklus lengkap, termasuk yang dibuang
+    uint8_t cycles;             // Siklus yang dijumlahkan
+    float sum_period_s;
+    float sum_amplitude;
+
+    // Hasil
+    float ku;                   // % daya per C
+    float tu_s;
+} fuzzy_autotune_t;
+
+void fuzzy_autotune_start(fuzzy_autotune_t *at, fuzzy_mode_t mode, float setpoint);
+// Satu langkah kontrol: suhu terukur dan dt, mengembalikan duty (%) untuk heater.
+// Setelah DONE/FAILED selalu 0.
+float fuzzy_autotune_step(fuzzy_autotune_t *at, float temp_c, float dt_s);
+uint8_t fuzzy_autotune_running(const fuzzy_autotune_t *at);
+
+// Skala gain dari Ku/Tu (hasil step atau dari profil tip); ku <= 0 = skala 1 (matriks asli)
+void fuzzy_autotune_apply(fuzzy_pid_t *fp, float ku, float tu_s);
+void fuzzy_autotune_apply_q(fuzzy_pid_q_t *fp, float ku, float tu_s);
+
+#endif
@@ -1,11 +1,85 @@
 #include "fuzzy_pid.h"
+#ifdef FUZZY_PID_HOST
+#include <math.h>               // Build host (examples/bench_surface)
+#else
 #include "arm_common_tables.h"
+#endif
+#include <stddef.h>
+#if FUZZY_PID_SURFACE
+#include "fuzzy_surface.h"
+#endif
 
 // Konstanta untuk akurasi tinggi
 #define MIN_OUTPUT_RESOLUTION 0.001f  // 0.1% resolusi
 #define FILTER_ALPHA 0.1f            // Koefisien filter low-pass
 #define DEADBAND_THRESHOLD 0.1f      // Threshold deadband (0.1%)
 
+// Matriks gain 5x5 [e][de]; M = FUZZY_F (float) atau Q16 (fixed-point).
+// Setelah mengubah matriks atau MF, fuzzy_surface.h dibuat ulang oleh
+// tools/gen_fuzzy_surface.py (otomatis saat build PlatformIO).
+#define FUZZY_F(x) (x)
+#define FUZZY_KP_T12(M) { \
+    {M(8.0f), M(6.0f), M(4.0f), M(3.0f), M(2.0f)}, \
+    {M(6.0f), M(4.0f), M(3.0f), M(2.0f), M(1.5f)}, \
+    {M(4.0f), M(3.0f), M(2.0f), M(1.5f), M(1.0f)}, \
+    {M(3.0f), M(2.0f), M(1.5f), M(1.0f), M(0.8f)}, \
+    {M(2.0f), M(1.5f), M(1.0f), M(0.8f), M(0.5f)} \
+}
+#define FUZZY_KI_T12(M) { \
+    {M(0.8f), M(0.6f), M(0.4f), M(0.2f), M(0.1f)}, \
+    {M(0.6f), M(0.4f), M(0.2f), M(0.15f), M(0.08f)}, \
+    {M(0.4f), M(0.2f), M(0.1f), M(0.08f), M(0.05f)}, \
+    {M(0.2f), M(0.15f), M(0.08f), M(0.05f), M(0.03f)}, \
+    {M(0.1f), M(0.08f), M(0.05f), M(0.03f), M(0.02f)} \
+}
+#define FUZZY_KD_T12(M) { \
+    {M(0.1f), M(0.2f), M(0.3f), M(0.4f), M(0.5f)}, \
+    {M(0.2f), M(0.3f), M(0.4f), M(0.5f), M(0.6f)}, \
+    {M(0.3f), M(0.4f), M(0.5f), M(0.6f), M(0.7f)}, \
+    {M(0.4f), M(0.5f), M(0.6f), M(0.7f), M(0.8f)}, \
+    {M(0.5f), M(0.6f), M(0.7f), M(0.8f), M(1.0f)} \
+}
+#define FUZZY_KP_HOT_AIR(M) { \
+    {M(4.0f), M(3.0f), M(2.0f), M(1.5f), M(1.0f)}, \
+    {M(3.0f), M(2.0f), M(1.5f), M(1.0f), M(0.8f)}, \
+    {M(2.0f), M(1.5f), M(1.0f), M(0.8f), M(0.6f)}, \
+    {M(1.5f), M(1.0f), M(0.8f), M(0.6f), M(0.4f)}, \
+    {M(1.0f), M(0.8f), M(0.6f), M(0.4f), M(0.3f)} \
+}
+#define FUZZY_KI_HOT_AIR(M) { \
+    {M(0.4f), M(0.3f), M(0.2f), M(0.1f), M(0.05f)}, \
+    {M(0.3f), M(0.2f), M(0.15f), M(0.08f), M(0.04f)}, \
+    {M(0.2f), M(0.15f), M(0.1f), M(0.06f), M(0.03f)}, \
+    {M(0.15f), M(0.1f), M(0.08f), M(0.05f), M(0.02f)}, \
+    {M(0.1f), M(0.08f), M(0.06f), M(0.04f), M(0.01f)} \
+}
+#define FUZZY_KD_HOT_AIR(M) { \
+    {M(0.05f), M(0.1f), M(0.15f), M(0.2f), M(0.25f)}, \
+    {M(0.1f), M(0.15f), M(0.2f), M(0.25f), M(0.3f)}, \
+    {M(0.15f), M(0.2f), M(0.25f), M(0.3f), M(0.35f)}, \
+    {M(0.2f), M(0.25f), M(0.3f), M(0.35f), M(0.4f)}, \
+    {M(0.25f), M(0.3f), M(0.35f), M(0.4f), M(0.5f)} \
+}
+
+// Gain tetap {Kp, Ki, Kd} per mode (indeks fuzzy_mode_t): DEFAULT saat init dan saat
+// tidak ada aturan aktif, FINE saat error < 0.1% (tanpa inferensi fuzzy)
+#define FUZZY_DEFAULT_GAINS(M) { \
+    {M(2.0f), M(0.1f), M(0.5f)},   /* MODE_SOLDER_T12 */ \
+    {M(1.0f), M(0.05f), M(0.25f)}  /* MODE_HOT_AIR */ \
+}
+#define FUZZY_FINE_GAINS(M) { \
+    {M(0.5f), M(0.02f), M(0.1f)}, \
+    {M(0.3f), M(0.01f), M(0.05f)} \
+}
+
+#if !FUZZY_PID_SURFACE
+static const float kp_t12[5][5] = FUZZY_KP_T12(FUZZY_F);
+static const float ki_t12[5][5] = FUZZY_KI_T12(FUZZY_F);
+static const float kd_t12[5][5] = FUZZY_KD_T12(FUZZY_F);
+static const float kp_hot_air[5][5] = FUZZY_KP_HOT_AIR(FUZZY_F);
+static const float ki_hot_air[5][5] = FUZZY_KI_HOT_AIR(FUZZY_F);
+static const float kd_hot_air[5][5] = FUZZY_KD_HOT_AIR(FUZZY_F);
+
 // Fungsi keanggotaan dengan smooth transition
 static float tri_mf(float x, float a, float b, float c) {
     if (x <= a || x >= c) return 0.0f;
@@ -27,40 +101,77 @@ static float trap_mf(float x, float a, float b, float c, float d) {
     float t = (d - x) / (d - c);
     return 0.5f * (1.0f - cosf(t * M_PI));
 }
+#endif
 
 // Fungsi smoothing output
 static float smooth_output(float current, float target, float alpha) {
     return alpha * target + (1.0f - alpha) * current;
 }
 
-// Enhanced fuzzy inference dengan lebih banyak aturan
-static void fuzzy_inference(fuzzy_pid_t *fp) {
-    float e = fp->error;
-    float de = fp->derivative;
-    
-    // Hitung error persentase untuk akurasi 0.1%
-    float e_percent = (fp->setpoint != 0.0f) ? 
-                     (e / fp->setpoint * 100.0f) : e;
-    
-    // Normalisasi berdasarkan mode
-    float e_norm, de_norm;
+static const float default_gains[2][3] = FUZZY_DEFAULT_GAINS(FUZZY_F);
+static const float fine_gains[2][3] = FUZZY_FINE_GAINS(FUZZY_F);
+
+static void fuzzy_fixed_gains(fuzzy_pid_t *fp, const float (*gains)[3]) {
+    const float *g = gains[(fp->mode == MODE_SOLDER_T12) ? 0 : 1];
+    fp->Kp = g[0];
+    fp->Ki = g[1];
+    fp->Kd = g[2];
+}
+
+// Gain default jika tidak ada aturan yang aktif
+static void fuzzy_default_gains(fuzzy_pid_t *fp) {
+    fuzzy_fixed_gains(fp, default_gains);
+}
+
+#if FUZZY_PID_SURFACE
+// Sel sumbu tidak seragam yang memuat x (pencarian biner) dan posisi 0..1 di dalamnya
+static int fuzzy_surface_cell(const float *axis, const float *inv, int points, float x, float *frac) {
+    int lo = 0, hi = points - 2;
+    while (lo < hi) {
+        int mid = (lo + hi + 1) >> 1;
+        if (axis[mid] <= x) {
+            lo = mid;
+        } else {
+            hi = mid - 1;
+        }
+    }
+    *frac = (x - axis[lo]) * inv[lo];
+    return lo;
+}
+
+static float fuzzy_surface_interp(const uint16_t (*surf)[FUZZY_SURFACE_DE_POINTS], int i, int j,
+                                  float fx, float fy) {
+    float lo = surf[i][j] + (surf[i + 1][j] - surf[i][j]) * fx;
+    float hi = surf[i][j + 1] + (surf[i + 1][j + 1] - surf[i][j + 1]) * fx;
+    return lo + (hi - lo) * fy;
+}
+
+// Gain dari permukaan tergenerasi: 2 pencarian sumbu + 3 interpolasi bilinear, tanpa
+// cosf dan 25 aturan. Deviasi terhadap fuzzy_rule_gains dilaporkan gen_fuzzy_surface.py --check.
+static void fuzzy_surface_gains(fuzzy_pid_t *fp, float e, float de) {
+    // Tepat di +-1 semua MF bernilai 0 (bobot nol): gain default seperti inferensi asli
+    if (fabsf(e) >= 1.0f || fabsf(de) >= 1.0f) {
+        fuzzy_default_gains(fp);
+        return;
+    }
+
+    float fx, fy;
+    int i = fuzzy_surface_cell(fuzzy_surface_e_axis, fuzzy_surface_e_inv, FUZZY_SURFACE_E_POINTS, e, &fx);
+    int j = fuzzy_surface_cell(fuzzy_surface_de_axis, fuzzy_surface_de_inv, FUZZY_SURFACE_DE_POINTS, de, &fy);
+
     if (fp->mode == MODE_SOLDER_T12) {
-        e_norm = e_percent / 5.0f;   // ±5% error untuk T12
-        de_norm = de / (fp->setpoint * 0.05f);  // 5% dari setpoint
+        fp->Kp = fuzzy_surface_interp(fuzzy_surface_kp_t12, i, j, fx, fy) * FUZZY_SURFACE_KP_SCALE;
+        fp->Ki = fuzzy_surface_interp(fuzzy_surface_ki_t12, i, j, fx, fy) * FUZZY_SURFACE_KI_SCALE;
+        fp->Kd = fuzzy_surface_interp(fuzzy_surface_kd_t12, i, j, fx, fy) * FUZZY_SURFACE_KD_SCALE;
     } else {
-        e_norm = e_percent / 10.0f;  // ±10% error untuk hot air
-        de_norm = de / (fp->setpoint * 0.1f);   // 10% dari setpoint
+        fp->Kp = fuzzy_surface_interp(fuzzy_surface_kp_hot_air, i, j, fx, fy) * FUZZY_SURFACE_KP_SCALE;
+        fp->Ki = fuzzy_surface_interp(fuzzy_surface_ki_hot_air, i, j, fx, fy) * FUZZY_SURFACE_KI_SCALE;
+        fp->Kd = fuzzy_surface_interp(fuzzy_surface_kd_hot_air, i, j, fx, fy) * FUZZY_SURFACE_KD_SCALE;
     }
-    
-    // Batasi dan beri smoothing
-    e_norm = fmaxf(-1.0f, fminf(1.0f, e_norm));
-    de_norm = fmaxf(-1.0f, fminf(1.0f, de_norm));
-    
-    // Filter input untuk mengurangi noise
-    static float e_filtered = 0.0f, de_filtered = 0.0f;
-    e_filtered = FILTER_ALPHA * e_norm + (1 - FILTER_ALPHA) * e_filtered;
-    de_filtered = FILTER_ALPHA * de_norm + (1 - FILTER_ALPHA) * de_filtered;
-    
+}
+#else
+// Inferensi asli: fuzzifikasi, 25 aturan, defuzzifikasi rata-rata terbobot
+static void fuzzy_rule_gains(fuzzy_pid_t *fp, float e_filtered, float de_filtered) {
     // Fuzzifikasi - hanya gunakan 5 MF dari 9 yang ada
     float e_neg_big = trap_mf(e_filtered, -1.0f, -1.0f, -0.8f, -0.4f);
     float e_neg_small = tri_mf(e_filtered, -0.8f, -0.4f, 0.0f);
@@ -96,29 +207,9 @@ static void fuzzy_inference(fuzzy_pid_t *fp) {
     
     if (fp->mode == MODE_SOLDER_T12) {
         // T12: Respons cepat dengan overshoot minimal
-        float kp_matrix[5][5] = {
-            {8.0f, 6.0f, 4.0f, 3.0f, 2.0f},
-            {6.0f, 4.0f, 3.0f, 2.0f, 1.5f},
-            {4.0f, 3.0f, 2.0f, 1.5f, 1.0f},
-            {3.0f, 2.0f, 1.5f, 1.0f, 0.8f},
-            {2.0f, 1.5f, 1.0f, 0.8f, 0.5f}
-        };
-        
-        float ki_matrix[5][5] = {
-            {0.8f, 0.6f, 0.4f, 0.2f, 0.1f},
-            {0.6f, 0.4f, 0.2f, 0.15f, 0.08f},
-            {0.4f, 0.2f, 0.1f, 0.08f, 0.05f},
-            {0.2f, 0.15f, 0.08f, 0.05f, 0.03f},
-            {0.1f, 0.08f, 0.05f, 0.03f, 0.02f}
-        };
-        
-        float kd_matrix[5][5] = {
-            {0.1f, 0.2f, 0.3f, 0.4f, 0.5f},
-            {0.2f, 0.3f, 0.4f, 0.5f, 0.6f},
-            {0.3f, 0.4f, 0.5f, 0.6f, 0.7f},
-            {0.4f, 0.5f, 0.6f, 0.7f, 0.8f},
-            {0.5f, 0.6f, 0.7f, 0.8f, 1.0f}
-        };
+        const float (*kp_matrix)[5] = kp_t12;
+        const float (*ki_matrix)[5] = ki_t12;
+        const float (*kd_matrix)[5] = kd_t12;
         
         // Hitung weighted sum
         idx = 0;
@@ -134,29 +225,9 @@ static void fuzzy_inference(fuzzy_pid_t *fp) {
         }
     } else {
         // Hot Air: Respons lebih halus
-        float kp_matrix[5][5] = {
-            {4.0f, 3.0f, 2.0f, 1.5f, 1.0f},
-            {3.0f, 2.0f, 1.5f, 1.0f, 0.8f},
-            {2.0f, 1.5f, 1.0f, 0.8f, 0.6f},
-            {1.5f, 1.0f, 0.8f, 0.6f, 0.4f},
-            {1.0f, 0.8f, 0.6f, 0.4f, 0.3f}
-        };
-        
-        float ki_matrix[5][5] = {
-            {0.4f, 0.3f, 0.2f, 0.1f, 0.05f},
-            {0.3f, 0.2f, 0.15f, 0.08f, 0.04f},
-            {0.2f, 0.15f, 0.1f, 0.06f, 0.03f},
-            {0.15f, 0.1f, 0.08f, 0.05f, 0.02f},
-            {0.1f, 0.08f, 0.06f, 0.04f, 0.01f}
-        };
-        
-        float kd_matrix[5][5] = {
-            {0.05f, 0.1f, 0.15f, 0.2f, 0.25f},
-            {0.1f, 0.15f, 0.2f, 0.25f, 0.3f},
-            {0.15f, 0.2f, 0.25f, 0.3f, 0.35f},
-            {0.2f, 0.25f, 0.3f, 0.35f, 0.4f},
-            {0.25f, 0.3f, 0.35f, 0.4f, 0.5f}
-        };
+        const float (*kp_matrix)[5] = kp_hot_air;
+        const float (*ki_matrix)[5] = ki_hot_air;
+        const float (*kd_matrix)[5] = kd_hot_air;
         
         idx = 0;
         for (int i = 0; i < 5; i++) {
@@ -171,29 +242,57 @@ static void fuzzy_inference(fuzzy_pid_t *fp) {
         }
     }
     
-    // Normalisasi dan batasi
+    // Normalisasi
     if (weight_sum > 1e-6f) {
         fp->Kp = kp_sum / weight_sum;
         fp->Ki = ki_sum / weight_sum;
         fp->Kd = kd_sum / weight_sum;
     } else {
-        // Default values jika weight_sum terlalu kecil
-        if (fp->mode == MODE_SOLDER_T12) {
-            fp->Kp = 2.0f;
-            fp->Ki = 0.1f;
-            fp->Kd = 0.5f;
-        } else {
-            fp->Kp = 1.0f;
-            fp->Ki = 0.05f;
-            fp->Kd = 0.25f;
-        }
+        fuzzy_default_gains(fp);
     }
+}
+#endif
+
+// Enhanced fuzzy inference dengan lebih banyak aturan
+static void fuzzy_inference(fuzzy_pid_t *fp) {
+    float e = fp->error;
+    float de = fp->derivative;
+    
+    // Hitung error persentase untuk akurasi 0.1%
+    float e_percent = (fp->setpoint != 0.0f) ? 
+                     (e / fp->setpoint * 100.0f) : e;
+    
+    // Normalisasi berdasarkan mode
+    float e_norm, de_norm;
+    if (fp->mode == MODE_SOLDER_T12) {
+        e_norm = e_percent / 5.0f;   // ±5% error untuk T12
+        de_norm = de / (fp->setpoint * 0.05f);  // 5% dari setpoint
+    } else {
+        e_norm = e_percent / 10.0f;  // ±10% error untuk hot air
+        de_norm = de / (fp->setpoint * 0.1f);   // 10% dari setpoint
+    }
+    
+    // Batasi dan beri smoothing
+    e_norm = fmaxf(-1.0f, fminf(1.0f, e_norm));
+    de_norm = fmaxf(-1.0f, fminf(1.0f, de_norm));
+    
+    // Filter input untuk mengurangi noise
+    fp->e_filtered = FILTER_ALPHA * e_norm + (1 - FILTER_ALPHA) * fp->e_filtered;
+    fp->de_filtered = FILTER_ALPHA * de_norm + (1 - FILTER_ALPHA) * fp->de_filtered;
+    
+#if FUZZY_PID_SURFACE
+    fuzzy_surface_gains(fp, fp->e_filtered, fp->de_filtered);
+#else
+    fuzzy_rule_gains(fp, fp->e_filtered, fp->de_filtered);
+#endif
     
     // Adaptive gain berdasarkan ukuran error
     float error_scale = 1.0f - fminf(fabsf(e_percent) / 10.0f, 0.9f);
     fp->Ki *= error_scale;  // Kurangi Ki saat mendekati setpoint
-    
-    // Batasi gain
+}
+
+// Batasi gain efektif (setelah skala autotune)
+static void fuzzy_clamp_gains(fuzzy_pid_t *fp) {
     if (fp->mode == MODE_SOLDER_T12) {
         fp->Kp = fmaxf(0.5f, fminf(10.0f, fp->Kp));
         fp->Ki = fmaxf(0.01f, fminf(1.0f, fp->Ki));
@@ -222,21 +321,20 @@ void fuzzy_pid_init(fuzzy_pid_t *fp, fuzzy_mode_t mode) {
     fp->filtered_error = 0.0f;
     fp->filtered_derivative = 0.0f;
     fp->output_smoother = 0.0f;
+    fp->e_filtered = 0.0f;
+    fp->de_filtered = 0.0f;
+    fp->measured_rate = 0.0f;
+    fp->use_measured_rate = 0;
+    fp->kp_scale = 1.0f;
+    fp->ki_scale = 1.0f;
+    fp->kd_scale = 1.0f;
     
     // Parameter untuk akurasi tinggi
     fp->deadband = DEADBAND_THRESHOLD;
     fp->output_resolution = MIN_OUTPUT_RESOLUTION;
     
     // Inisialisasi gain default
-    if (mode == MODE_SOLDER_T12) {
-        fp->Kp = 2.0f;
-        fp->Ki = 0.1f;
-        fp->Kd = 0.5f;
-    } else {
-        fp->Kp = 1.0f;
-        fp->Ki = 0.05f;
-        fp->Kd = 0.25f;
-    }
+    fuzzy_default_gains(fp);
 }
 
 void fuzzy_pid_set_mode(fuzzy_pid_t *fp, fuzzy_mode_t mode) {
@@ -257,6 +355,13 @@ void fuzzy_pid_set_setpoint(fuzzy_pid_t *fp, float setpoint) {
     fp->setpoint = setpoint;
 }
 
+// Set periode sampling aktual (detik), misalnya dari task_current_period_ms()
+void fuzzy_pid_set_dt(fuzzy_pid_t *fp, float dt_s) {
+    if (dt_s > 0.0f) {
+        fp->dt = dt_s;
+    }
+}
+
 float fuzzy_pid_update(fuzzy_pid_t *fp) {
     // Hitung error
     fp->error = fp->setpoint - fp->feedback;
@@ -265,10 +370,14 @@ float fuzzy_pid_update(fuzzy_pid_t *fp) {
     fp->filtered_error = FILTER_ALPHA * fp->error + 
                         (1.0f - FILTER_ALPHA) * fp->filtered_error;
     
-    // Hitung derivative dengan filter
-    float raw_derivative = (fp->filtered_error - fp->prev_error) / fp->dt;
-    fp->filtered_derivative = FILTER_ALPHA * raw_derivative + 
-                             (1.0f - FILTER_ALPHA) * fp->filtered_derivative;
+    // Hitung derivative: dari observer (de/dt = -dT/dt, setpoint tetap) atau beda hingga terfilter
+    if (fp->use_measured_rate) {
+        fp->filtered_derivative = -fp->measured_rate;
+    } else {
+        float raw_derivative = (fp->filtered_error - fp->prev_error) / fp->dt;
+        fp->filtered_derivative = FILTER_ALPHA * raw_derivative + 
+                                 (1.0f - FILTER_ALPHA) * fp->filtered_derivative;
+    }
     fp->derivative = fp->filtered_derivative;
     
     // Update integral dengan anti-windup yang lebih canggih
@@ -295,10 +404,12 @@ float fuzzy_pid_update(fuzzy_pid_t *fp) {
         fuzzy_inference(fp);
     } else {
         // Mode fine-tuning: gunakan gain kecil tetap
-        fp->Kp = (fp->mode == MODE_SOLDER_T12) ? 0.5f : 0.3f;
-        fp->Ki = (fp->mode == MODE_SOLDER_T12) ? 0.02f : 0.01f;
-        fp->Kd = (fp->mode == MODE_SOLDER_T12) ? 0.1f : 0.05f;
+        fuzzy_fixed_gains(fp, fine_gains);
     }
+    fp->Kp *= fp->kp_scale;
+    fp->Ki *= fp->ki_scale;
+    fp->Kd *= fp->kd_scale;
+    fuzzy_clamp_gains(fp);
     
     // Hitung output PID
     float proportional = fp->Kp * fp->error;
@@ -330,6 +441,17 @@ float fuzzy_pid_update(fuzzy_pid_t *fp) {
     return fp->output;
 }
 
+// Semua state ada di fuzzy_pid_t, jadi beberapa controller (T12 + hot air) bisa
+// diupdate berurutan dalam satu task tanpa saling mengganggu
+void fuzzy_pid_update_all(fuzzy_pid_t *fps, uint8_t count, float *outputs) {
+    for (uint8_t i = 0; i < count; i++) {
+        float out = fuzzy_pid_update(&fps[i]);
+        if (outputs != NULL) {
+            outputs[i] = out;
+        }
+    }
+}
+
 // Fungsi untuk tuning real-time
 void fuzzy_pid_tune(fuzzy_pid_t *fp, float kp_scale, float ki_scale, float kd_scale) {
     fp->Kp *= kp_scale;
@@ -337,7 +459,291 @@ void fuzzy_pid_tune(fuzzy_pid_t *fp, float kp_scale, float ki_scale, float kd_sc
     fp->Kd *= kd_scale;
 }
 
+void fuzzy_pid_set_gain_scale(fuzzy_pid_t *fp, float kp_scale, float ki_scale, float kd_scale) {
+    fp->kp_scale = kp_scale;
+    fp->ki_scale = ki_scale;
+    fp->kd_scale = kd_scale;
+}
+
+void fuzzy_pid_set_rate(fuzzy_pid_t *fp, float rate_c_per_s) {
+    fp->measured_rate = rate_c_per_s;
+    fp->use_measured_rate = 1;
+}
+
 // Fungsi untuk set deadband
 void fuzzy_pid_set_deadband(fuzzy_pid_t *fp, float percent) {
     fp->deadband = fmaxf(0.01f, fminf(5.0f, percent));
+}
+
+// --- Versi fixed-point Q16.16 ---
+// Port langsung fuzzy_inference/fuzzy_pid_update; pembagian dengan konstanta diganti
+// perkalian kebalikan, cosf diganti tabel. Tidak memakai float saat runtime.
+
+static const q16_t kp_t12_q[5][5] = FUZZY_KP_T12(Q16);
+static const q16_t ki_t12_q[5][5] = FUZZY_KI_T12(Q16);
+static const q16_t kd_t12_q[5][5] = FUZZY_KD_T12(Q16);
+static const q16_t kp_hot_air_q[5][5] = FUZZY_KP_HOT_AIR(Q16);
+static const q16_t ki_hot_air_q[5][5] = FUZZY_KI_HOT_AIR(Q16);
+static const q16_t kd_hot_air_q[5][5] = FUZZY_KD_HOT_AIR(Q16);
+static const q16_t default_gains_q[2][3] = FUZZY_DEFAULT_GAINS(Q16);
+static const q16_t fine_gains_q[2][3] = FUZZY_FINE_GAINS(Q16);
+
+static void fuzzy_fixed_gains_q(fuzzy_pid_q_t *fp, const q16_t (*gains)[3]) {
+    const q16_t *g = gains[(fp->mode == MODE_SOLDER_T12) ? 0 : 1];
+    fp->Kp = g[0];
+    fp->Ki = g[1];
+    fp->Kd = g[2];
+}
+
+// 0.5 * (1 - cos(pi * t)), t = 0..1 dalam 32 segmen (error interpolasi < 0.001)
+static const q16_t smooth_step_q[33] = {
+    0, 158, 630, 1411, 2494, 3869, 5522, 7438,
+    9598, 11980, 14563, 17321, 20228, 23256, 26375, 29556,
+    32768, 35980, 39161, 42280, 45308, 48215, 50973, 53556,
+    55938, 58098, 60014, 61667, 63042, 64125, 64906, 65378,
+    65536
+};
+
+// Kebalikan lebar segmen MF (konstanta saat kompilasi, lebar 0 tidak pernah dipakai)
+#define Q16_INV(w) Q16(1.0f / (((w) > 0.0f) ? (w) : 1.0f))
+
+#define TRI_MF_Q(x, a, b, c) \
+    tri_mf_q((x), Q16(a), Q16(b), Q16(c), Q16_INV((b) - (a)), Q16_INV((c) - (b)))
+#define TRAP_MF_Q(x, a, b, c, d) \
+    trap_mf_q((x), Q16(a), Q16(b), Q16(c), Q16(d), Q16_INV((b) - (a)), Q16_INV((d) - (c)))
+
+static inline q16_t tri_mf_q(q16_t x, q16_t a, q16_t b, q16_t c, q16_t inv_ab, q16_t inv_bc) {
+    if (x <= a || x >= c) return 0;
+    q16_t t = (x < b) ? q16_mul(x - a, inv_ab) : q16_mul(c - x, inv_bc);
+    return q16_mul(t, t);
+}
+
+static inline q16_t trap_mf_q(q16_t x, q16_t a, q16_t b, q16_t c, q16_t d, q16_t inv_ab, q16_t inv_cd) {
+    if (x <= a || x >= d) return 0;
+    q16_t t;
+    if (x < b) {
+        t = q16_mul(x - a, inv_ab);
+    } else if (x <= c) {
+        return Q16_ONE;
+    } else {
+        t = q16_mul(d - x, inv_cd);
+    }
+    t = q16_clamp(t, 0, Q16_ONE);
+    return q16_lut_interp(smooth_step_q, 33, t * 32);
+}
+
+static void fuzzy_inference_q(fuzzy_pid_q_t *fp) {
+    q16_t e_percent = (fp->setpoint != 0) ? q16_mul(fp->error, fp->percent_scale) : fp->error;
+
+    q16_t e_norm = (fp->mode == MODE_SOLDER_T12) ? e_percent / 5 : e_percent / 10;
+    q16_t de_norm = q16_mul(fp->derivative, fp->de_scale);
+    e_norm = q16_clamp(e_norm, -Q16_ONE, Q16_ONE);
+    de_norm = q16_clamp(de_norm, -Q16_ONE, Q16_ONE);
+
+    fp->e_filtered = q16_lerp(fp->e_filtered, e_norm, Q16(FILTER_ALPHA));
+    fp->de_filtered = q16_lerp(fp->de_filtered, de_norm, Q16(FILTER_ALPHA));
+
+    q16_t e_mf[5] = {
+        TRAP_MF_Q(fp->e_filtered, -1.0f, -1.0f, -0.8f, -0.4f),
+        TRI_MF_Q(fp->e_filtered, -0.8f, -0.4f, 0.0f),
+        TRI_MF_Q(fp->e_filtered, -0.1f, 0.0f, 0.1f),
+        TRI_MF_Q(fp->e_filtered, 0.0f, 0.4f, 0.8f),
+        TRAP_MF_Q(fp->e_filtered, 0.4f, 0.8f, 1.0f, 1.0f)
+    };
+    q16_t de_mf[5] = {
+        TRAP_MF_Q(fp->de_filtered, -1.0f, -1.0f, -0.8f, -0.4f),
+        TRI_MF_Q(fp->de_filtered, -0.8f, -0.4f, 0.0f),
+        TRI_MF_Q(fp->de_filtered, -0.05f, 0.0f, 0.05f),
+        TRI_MF_Q(fp->de_filtered, 0.0f, 0.4f, 0.8f),
+        TRAP_MF_Q(fp->de_filtered, 0.4f, 0.8f, 1.0f, 1.0f)
+    };
+
+    const q16_t (*kp_matrix)[5] = (fp->mode == MODE_SOLDER_T12) ? kp_t12_q : kp_hot_air_q;
+    const q16_t (*ki_matrix)[5] = (fp->mode == MODE_SOLDER_T12) ? ki_t12_q : ki_hot_air_q;
+    const q16_t (*kd_matrix)[5] = (fp->mode == MODE_SOLDER_T12) ? kd_t12_q : kd_hot_air_q;
+
+    q16_t kp_sum = 0, ki_sum = 0, kd_sum = 0, weight_sum = 0;
+    for (int i = 0; i < 5; i++) {
+        for (int j = 0; j < 5; j++) {
+            q16_t w = q16_min(e_mf[i], de_mf[j]);
+            if (w == 0) continue;
+            kp_sum += q16_mul(w, kp_matrix[i][j]);
+            ki_sum += q16_mul(w, ki_matrix[i][j]);
+            kd_sum += q16_mul(w, kd_matrix[i][j]);
+            weight_sum += w;
+        }
+    }
+
+    if (weight_sum > 0) {
+        fp->Kp = q16_div(kp_sum, weight_sum);
+        fp->Ki = q16_div(ki_sum, weight_sum);
+        fp->Kd = q16_div(kd_sum, weight_sum);
+    } else {
+        fuzzy_fixed_gains_q(fp, default_gains_q);
+    }
+
+    // Adaptive gain berdasarkan ukuran error
+    q16_t error_scale = Q16_ONE - q16_min(q16_abs(e_percent) / 10, Q16(0.9f));
+    fp->Ki = q16_mul(fp->Ki, error_scale);
+}
+
+static void fuzzy_clamp_gains_q(fuzzy_pid_q_t *fp) {
+    if (fp->mode == MODE_SOLDER_T12) {
+        fp->Kp = q16_clamp(fp->Kp, Q16(0.5f), Q16(10.0f));
+        fp->Ki = q16_clamp(fp->Ki, Q16(0.01f), Q16(1.0f));
+        fp->Kd = q16_clamp(fp->Kd, Q16(0.05f), Q16(2.0f));
+    } else {
+        fp->Kp = q16_clamp(fp->Kp, Q16(0.3f), Q16(5.0f));
+        fp->Ki = q16_clamp(fp->Ki, Q16(0.005f), Q16(0.5f));
+        fp->Kd = q16_clamp(fp->Kd, Q16(0.02f), Q16(1.0f));
+    }
+}
+
+void fuzzy_pid_q_init(fuzzy_pid_q_t *fp, fuzzy_mode_t mode) {
+    fp->feedback = 0;
+    fp->error = 0;
+    fp->prev_error = 0;
+    fp->integral = 0;
+    fp->derivative = 0;
+    fp->output = 0;
+    fp->prev_output = 0;
+    fp->filtered_error = 0;
+    fp->filtered_derivative = 0;
+    fp->e_filtered = 0;
+    fp->de_filtered = 0;
+    fp->measured_rate = 0;
+    fp->use_measured_rate = 0;
+    fp->mode = mode;
+    fp->deadband = Q16(DEADBAND_THRESHOLD);
+    fp->kp_scale = Q16_ONE;
+    fp->ki_scale = Q16_ONE;
+    fp->kd_scale = Q16_ONE;
+
+    if (mode == MODE_SOLDER_T12) {
+        fp->max_power = Q16(T12_MAX_POWER);
+        fp->output_step = Q16(T12_MAX_POWER * MIN_OUTPUT_RESOLUTION);
+        fp->output_step_inv = Q16(1.0f / (T12_MAX_POWER * MIN_OUTPUT_RESOLUTION));
+    } else {
+        fp->max_power = Q16(HOT_AIR_MAX_POWER);
+        fp->output_step = Q16(HOT_AIR_MAX_POWER * MIN_OUTPUT_RESOLUTION);
+        fp->output_step_inv = Q16(1.0f / (HOT_AIR_MAX_POWER * MIN_OUTPUT_RESOLUTION));
+    }
+    fuzzy_fixed_gains_q(fp, default_gains_q);
+
+    fp->dt_us = 0;
+    fuzzy_pid_q_set_dt_us(fp, (uint32_t)(FUZZY_PID_DT_MS * 1000.0f));
+    fuzzy_pid_q_set_setpoint(fp, 0);
+}
+
+void fuzzy_pid_q_reset(fuzzy_pid_q_t *fp) {
+    fp->integral = 0;
+    fp->prev_error = fp->error;
+    fp->prev_output = fp->output;
+    fp->filtered_error = 0;
+    fp->filtered_derivative = 0;
+}
+
+// Pembagian hanya di sini (jarang berubah), bukan di setiap update
+void fuzzy_pid_q_set_setpoint(fuzzy_pid_q_t *fp, q16_t setpoint) {
+    fp->setpoint = setpoint;
+    if (setpoint != 0) {
+        q16_t span = (fp->mode == MODE_SOLDER_T12) ? q16_mul(setpoint, Q16(0.05f)) : q16_mul(setpoint, Q16(0.1f));
+        fp->percent_scale = q16_div(Q16(100.0f), setpoint);
+        fp->de_scale = q16_div(Q16_ONE, span);
+    } else {
+        fp->percent_scale = Q16_ONE;
+        fp->de_scale = Q16_ONE;
+    }
+    fp->deadband_abs = q16_mul(setpoint, fp->deadband) / 100;
+}
+
+void fuzzy_pid_q_set_gain_scale(fuzzy_pid_q_t *fp, q16_t kp_scale, q16_t ki_scale, q16_t kd_scale) {
+    fp->kp_scale = kp_scale;
+    fp->ki_scale = ki_scale;
+    fp->kd_scale = kd_scale;
+}
+
+void fuzzy_pid_q_set_dt_us(fuzzy_pid_q_t *fp, uint32_t dt_us) {
+    if (dt_us == 0 || dt_us == fp->dt_us) {
+        return;
+    }
+    fp->dt_us = dt_us;
+    fp->dt_q32 = (uint32_t)(((uint64_t)dt_us << 32) / 1000000u);
+    fp->inv_dt = q16_sat(((int64_t)1000000 << Q16_SHIFT) / dt_us);
+}
+
+void fuzzy_pid_q_set_rate(fuzzy_pid_q_t *fp, q16_t rate_c_per_s) {
+    fp->measured_rate = rate_c_per_s;
+    fp->use_measured_rate = 1;
+}
+
+// Output % daya (Q16); selisih terhadap fuzzy_pid_update dengan input yang sama
+// maksimal +-0.25% daya (error pembulatan skala setpoint dan tabel cos)
+q16_t fuzzy_pid_update_q(fuzzy_pid_q_t *fp) {
+    fp->error = fp->setpoint - fp->feedback;
+    fp->filtered_error = q16_lerp(fp->filtered_error, fp->error, Q16(FILTER_ALPHA));
+
+    // Turunan: dari observer (de/dt = -dT/dt, setpoint tetap) atau beda hingga terfilter
+    if (fp->use_measured_rate) {
+        fp->filtered_derivative = -fp->measured_rate;
+    } else {
+        q16_t raw_derivative = q16_mul(fp->filtered_error - fp->prev_error, fp->inv_dt);
+        fp->filtered_derivative = q16_lerp(fp->filtered_derivative, raw_derivative, Q16(FILTER_ALPHA));
+    }
+    fp->derivative = fp->filtered_derivative;
+
+    q16_t error_percent = (fp->setpoint != 0) ? q16_mul(q16_abs(fp->error), fp->percent_scale)
+                                              : q16_abs(fp->error);
+
+    // Conditional integration: integral += error * dt * Ki
+    if (error_percent > Q16(0.5f)) {
+        int64_t step = ((int64_t)q16_mul(fp->error, fp->Ki) * fp->dt_q32) >> 32;
+        fp->integral = q16_sat((int64_t)fp->integral + step);
+    } else {
+        fp->integral = q16_mul(fp->integral, Q16(0.99f));
+    }
+
+    q16_t max_integral = q16_div(fp->max_power, (fp->Ki > 0) ? fp->Ki : 1);
+    fp->integral = q16_clamp(fp->integral, -max_integral, max_integral);
+
+    if (error_percent > Q16(0.1f)) {
+        fuzzy_inference_q(fp);
+    } else {
+        fuzzy_fixed_gains_q(fp, fine_gains_q);
+    }
+    fp->Kp = q16_mul(fp->Kp, fp->kp_scale);
+    fp->Ki = q16_mul(fp->Ki, fp->ki_scale);
+    fp->Kd = q16_mul(fp->Kd, fp->kd_scale);
+    fuzzy_clamp_gains_q(fp);
+
+    int64_t raw_output = (int64_t)q16_mul(fp->Kp, fp->error)
+                       + q16_mul(fp->Ki, fp->integral)
+                       + q16_mul(fp->Kd, fp->derivative);
+    q16_t raw = q16_sat(raw_output);
+
+    if (q16_abs(fp->error) < fp->deadband_abs) {
+        raw = q16_mul(fp->prev_output, Q16(0.9f));
+    }
+
+    q16_t alpha = (error_percent > Q16_ONE) ? Q16(0.5f) : Q16(0.2f);
+    q16_t output = q16_lerp(fp->prev_output, raw, alpha);
+
+    // Kuantisasi ke resolusi output (dibulatkan)
+    int32_t steps = (int32_t)((((int64_t)output * fp->output_step_inv) + ((int64_t)1 << 31)) >> 32);
+    output = q16_sat((int64_t)steps * fp->output_step);
+
+    fp->output = q16_clamp(output, 0, fp->max_power);
+    fp->prev_error = fp->filtered_error;
+    fp->prev_output = fp->output;
+
+    return fp->output;
+}
+
+void fuzzy_pid_update_all_q(fuzzy_pid_q_t *fps, uint8_t count, q16_t *outputs) {
+    for (uint8_t i = 0; i < count; i++) {
+        q16_t out = fuzzy_pid_update_q(&fps[i]);
+        if (outputs != NULL) {
+            outputs[i] = out;
+        }
+    }
 }
\ No newline at end of file
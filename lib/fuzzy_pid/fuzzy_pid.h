@@ -6,6 +6,7 @@ extern "C" {
 #endif
 
 #include <stdint.h>
+#include "qmath.h"
 
 // Definisikan M_PI jika belum didefinisikan
 #ifndef M_PI
@@ -38,6 +39,15 @@ typedef struct {
     float filtered_error;
     float filtered_derivative;
     float output_smoother;
+    float e_filtered;           // Input fuzzy ternormalisasi setelah filter
+    float de_filtered;
+
+    // Laju suhu dari luar (observer): menggantikan turunan beda hingga jika aktif
+    float measured_rate;        // dT/dt (C/s)
+    uint8_t use_measured_rate;
+
+    // Skala gain per heater (autotune), dikalikan ke gain fuzzy setiap update
+    float kp_scale, ki_scale, kd_scale;
     
     // Configuration
     fuzzy_mode_t mode;
@@ -46,19 +56,85 @@ typedef struct {
     float output_resolution;
 } fuzzy_pid_t;
 
+// Versi fixed-point Q16.16 (tanpa float/FPU), algoritma sama dengan fuzzy_pid_t.
+// Output berbeda dari versi float maksimal +-0.25% daya (lihat fuzzy_pid_update_q).
+typedef struct {
+    q16_t Kp, Ki, Kd;
+    q16_t setpoint;             // C
+    q16_t feedback;             // C
+    uint32_t dt_us;
+    uint32_t dt_q32;            // dt dalam detik, Q0.32
+    q16_t inv_dt;               // 1/dt (Hz)
+
+    q16_t error;
+    q16_t prev_error;
+    q16_t integral;
+    q16_t derivative;
+    q16_t output;               // % daya
+    q16_t prev_output;
+
+    q16_t filtered_error;
+    q16_t filtered_derivative;
+    q16_t e_filtered;           // Input fuzzy setelah filter
+    q16_t de_filtered;
+
+    // Laju suhu dari luar (observer), sama dengan fuzzy_pid_t
+    q16_t measured_rate;        // dT/dt (C/s)
+    uint8_t use_measured_rate;
+
+    // Skala turunan dari setpoint (dihitung di fuzzy_pid_q_set_setpoint)
+    q16_t percent_scale;        // 100/setpoint
+    q16_t de_scale;             // 1/(setpoint * rentang de)
+    q16_t deadband_abs;         // C
+
+    q16_t kp_scale, ki_scale, kd_scale;
+
+    fuzzy_mode_t mode;
+    q16_t max_power;
+    q16_t deadband;             // %
+    q16_t output_step;          // Kuantisasi output
+    q16_t output_step_inv;
+} fuzzy_pid_q_t;
+
 // Konstanta
 #define FUZZY_PID_DT_MS 10.0f  // 10ms sampling time
 #define T12_MAX_POWER 100.0f   // 100% power untuk T12
 #define HOT_AIR_MAX_POWER 100.0f // 100% power untuk hot air
 
+// Gain fuzzy versi float dibaca dari permukaan Kp/Ki/Kd tergenerasi (fuzzy_surface.h,
+// interpolasi bilinear) alih-alih mengevaluasi 25 aturan setiap update.
+// 0 = inferensi aturan asli (referensi, tanpa tabel ~16 KB di flash).
+#ifndef FUZZY_PID_SURFACE
+#define FUZZY_PID_SURFACE 1
+#endif
+
 // Fungsi publik
 void fuzzy_pid_init(fuzzy_pid_t *fp, fuzzy_mode_t mode);
 void fuzzy_pid_set_mode(fuzzy_pid_t *fp, fuzzy_mode_t mode);
 void fuzzy_pid_reset(fuzzy_pid_t *fp);
 void fuzzy_pid_set_setpoint(fuzzy_pid_t *fp, float setpoint);
+void fuzzy_pid_set_dt(fuzzy_pid_t *fp, float dt_s);
 float fuzzy_pid_update(fuzzy_pid_t *fp);
+// Update count controller (feedback sudah diisi); outputs[i] = hasil fps[i], boleh NULL
+void fuzzy_pid_update_all(fuzzy_pid_t *fps, uint8_t count, float *outputs);
 void fuzzy_pid_tune(fuzzy_pid_t *fp, float kp_scale, float ki_scale, float kd_scale);
 void fuzzy_pid_set_deadband(fuzzy_pid_t *fp, float percent);
+// Pakai dT/dt estimasi (mis. tip_observer) untuk suku D dan input fuzzy de, dipanggil
+// sebelum fuzzy_pid_update setiap langkah. Berlaku sampai fuzzy_pid_init.
+void fuzzy_pid_set_rate(fuzzy_pid_t *fp, float rate_c_per_s);
+// Skala permukaan gain untuk heater yang terpasang (lihat fuzzy_autotune.h); 1 = matriks asli.
+// Gain hasil skala tetap dibatasi batas Kp/Ki/Kd per mode.
+void fuzzy_pid_set_gain_scale(fuzzy_pid_t *fp, float kp_scale, float ki_scale, float kd_scale);
+
+void fuzzy_pid_q_init(fuzzy_pid_q_t *fp, fuzzy_mode_t mode);
+void fuzzy_pid_q_reset(fuzzy_pid_q_t *fp);
+void fuzzy_pid_q_set_setpoint(fuzzy_pid_q_t *fp, q16_t setpoint);
+void fuzzy_pid_q_set_dt_us(fuzzy_pid_q_t *fp, uint32_t dt_us);
+// Versi Q16 fuzzy_pid_set_rate (C/s)
+void fuzzy_pid_q_set_rate(fuzzy_pid_q_t *fp, q16_t rate_c_per_s);
+q16_t fuzzy_pid_update_q(fuzzy_pid_q_t *fp);
+void fuzzy_pid_q_set_gain_scale(fuzzy_pid_q_t *fp, q16_t kp_scale, q16_t ki_scale, q16_t kd_scale);
+void fuzzy_pid_update_all_q(fuzzy_pid_q_t *fps, uint8_t count, q16_t *outputs);
 
 #ifdef __cplusplus
 }
@@ -0,0 +1,731 @@
+#ifndef FUZZY_SURFACE_H
+#define FUZZY_SURFACE_H
+
+// DIBUAT OTOMATIS oleh tools/gen_fuzzy_surface.py dari matriks di fuzzy_pid.c
+// - jangan diedit manual.
+
+#include <stdint.h>
+
+#define FUZZY_SURFACE_E_POINTS  37
+#define FUZZY_SURFACE_DE_POINTS 37
+
+// Sumbu grid (e_filtered, de_filtered) dan kebalikan lebar tiap sel
+static const float fuzzy_surface_e_axis[37] = {
+    -1.000000f, -0.800000f, -0.775000f, -0.750000f, -0.725000f, -0.700000f, -0.650000f, -0.600000f,
+    -0.500000f, -0.450000f, -0.437500f, -0.425000f, -0.400000f, -0.250000f, -0.100000f, -0.087500f,
+    -0.075000f, -0.050000f, 0.000000f, 0.050000f, 0.075000f, 0.087500f, 0.100000f, 0.250000f,
+    0.400000f, 0.425000f, 0.437500f, 0.450000f, 0.500000f, 0.600000f, 0.650000f, 0.700000f,
+    0.725000f, 0.750000f, 0.775000f, 0.800000f, 1.000000f
+};
+static const float fuzzy_surface_e_inv[36] = {
+    5.000000f, 40.000000f, 40.000000f, 40.000000f, 40.000000f, 20.000000f, 20.000000f, 10.000000f,
+    20.000000f, 80.000000f, 80.000000f, 40.000000f, 6.666667f, 6.666667f, 80.000000f, 80.000000f,
+    40.000000f, 20.000000f, 20.000000f, 40.000000f, 80.000000f, 80.000000f, 6.666667f, 6.666667f,
+    40.000000f, 80.000000f, 80.000000f, 20.000000f, 10.000000f, 20.000000f, 20.000000f, 40.000000f,
+    40.000000f, 40.000000f, 40.000000f, 5.000000f
+};
+static const float fuzzy_surface_de_axis[37] = {
+    -1.000000f, -0.800000f, -0.750000f, -0.700000f, -0.675000f, -0.650000f, -0.600000f, -0.500000f,
+    -0.475000f, -0.450000f, -0.400000f, -0.225000f, -0.137500f, -0.093750f, -0.050000f, -0.043750f,
+    -0.037500f, -0.025000f, 0.000000f, 0.025000f, 0.037500f, 0.043750f, 0.050000f, 0.093750f,
+    0.137500f, 0.225000f, 0.400000f, 0.450000f, 0.475000f, 0.500000f, 0.600000f, 0.650000f,
+    0.675000f, 0.700000f, 0.750000f, 0.800000f, 1.000000f
+};
+static const float fuzzy_surface_de_inv[36] = {
+    5.000000f, 20.000000f, 20.000000f, 40.000000f, 40.000000f, 20.000000f, 10.000000f, 40.000000f,
+    40.000000f, 20.000000f, 5.714286f, 11.428571f, 22.857143f, 22.857143f, 160.000000f, 160.000000f,
+    80.000000f, 40.000000f, 40.000000f, 80.000000f, 160.000000f, 160.000000f, 22.857143f, 22.857143f,
+    11.428571f, 5.714286f, 20.000000f, 40.000000f, 40.000000f, 10.000000f, 20.000000f, 40.000000f,
+    40.000000f, 20.000000f, 20.000000f, 5.000000f
+};
+
+// Gain hasil inferensi sebelum adaptasi Ki dan pembatasan: nilai = raw * skala
+#define FUZZY_SURFACE_KP_SCALE  1.220721752e-04f
+#define FUZZY_SURFACE_KI_SCALE  1.220721752e-05f
+#define FUZZY_SURFACE_KD_SCALE  1.525902190e-05f
+
+static const uint16_t fuzzy_surface_kp_t12[FUZZY_SURFACE_E_POINTS][FUZZY_SURFACE_DE_POINTS] = {
+    {65535, 65535, 65273, 64417, 63707, 62766, 60074, 52536, 51006, 49927, 49151, 49151, 49151,
+     49151, 49151, 39872, 34787, 33020, 32768, 32641, 31758, 29215, 24576, 24576, 24576, 24576,
+     24576, 24188, 23648, 22883, 19114, 17768, 17298, 16943, 16515, 16384, 16384},
+    {65535, 65535, 65273, 64417, 63707, 62766, 60074, 52536, 51006, 49927, 49151, 49151, 49151,
+     49151, 49151, 39872, 34787, 33020, 32768, 32641, 31758, 29215, 24576, 24576, 24576, 24576,
+     24576, 24188, 23648, 22883, 19114, 17768, 17298, 16943, 16515, 16384, 16384},
+    {65471, 65471, 65080, 64219, 63506, 62563, 59877, 52409, 50901, 49841, 49087, 48951, 48627,
+     48064, 45875, 37400, 34183, 32890, 32735, 32278, 30644, 27287, 22937, 24032, 24313, 24476,
+     24543, 24093, 23552, 22790, 19065, 17736, 17271, 16921, 16497, 16368, 16368},
+    {65273, 65273, 64520, 63643, 62923, 61976, 59309, 52047, 50601, 49591, 48889, 48380, 47238,
+     45523, 40959, 34000, 32935, 32533, 32637, 31948, 29173, 25119, 20480, 22762, 23619, 24190,
+     24445, 23819, 23273, 22523, 18923, 17644, 17195, 16857, 16447, 16318, 16318},
+    {64929, 64929, 64167, 62745, 62016, 61066, 58435, 51491, 50139, 49206, 48546, 47513, 45394,
+     42758, 40959, 34000, 31518, 32003, 32465, 31457, 28394, 25119, 20480, 21379, 22697, 23756,
+     24273, 23395, 22845, 22112, 18705, 17501, 17077, 16757, 16367, 16232, 16232},
+    {64417, 64417, 63643, 61601, 60865, 59917, 57343, 50800, 49561, 48708, 48033, 46449, 43483,
+     40959, 40959, 34000, 30186, 31369, 32209, 30869, 27662, 25119, 20480, 20480, 21742, 23224,
+     24017, 23147, 22309, 21602, 18432, 17320, 16928, 16630, 16249, 16104, 16104},
+    {62766, 62766, 61976, 59917, 58620, 57256, 54861, 49248, 48199, 47301, 46382, 44110, 40959,
+     40959, 40959, 34000, 30186, 30037, 31383, 29635, 27662, 25119, 20480, 20480, 20480, 22055,
+     23191, 22449, 21607, 20456, 17811, 16901, 16602, 16317, 15865, 15691, 15691},
+    {60074, 60074, 59309, 57343, 56124, 54861, 52428, 47524, 46195, 44948, 43690, 41920, 40959,
+     40959, 40959, 34000, 30186, 28861, 30037, 28546, 27662, 25119, 20480, 20480, 20480, 20960,
+     21845, 21153, 20467, 19736, 17203, 16508, 16147, 15799, 15237, 15018, 15018},
+    {52536, 52536, 52047, 50800, 50035, 49248, 47524, 42347, 40222, 38207, 36152, 37951, 40959,
+     40959, 40959, 34000, 30186, 27860, 26268, 27464, 27662, 25119, 20480, 20480, 20480, 18976,
+     18076, 17713, 17358, 16982, 15570, 15220, 14721, 14235, 13444, 13134, 13134},
+    {49927, 49927, 49591, 48708, 48112, 47301, 44948, 38207, 36730, 35603, 33543, 34527, 36759,
+     39473, 40959, 34000, 29653, 26062, 24964, 25521, 26605, 25119, 20480, 19737, 18380, 17263,
+     16772, 16561, 16343, 16017, 14282, 13609, 13377, 13261, 12781, 12482, 12482},
+    {49570, 49570, 49262, 48427, 47793, 46921, 44431, 37365, 35864, 34754, 33186, 33811, 35293,
+     37381, 40959, 34000, 29146, 25665, 24785, 25092, 25603, 25119, 20480, 18690, 17646, 16906,
+     16593, 16408, 16169, 15821, 14024, 13349, 13107, 12945, 12682, 12392, 12392},
+    {49328, 49328, 49043, 48225, 47539, 46629, 44031, 36711, 35194, 34099, 32945, 33250, 33999,
+     35206, 39006, 33396, 28664, 25349, 24664, 24750, 24650, 24163, 19503, 17603, 17000, 16625,
+     16472, 16290, 16035, 15668, 13824, 13149, 12911, 12730, 12530, 12332, 12332},
+    {49151, 49151, 48889, 48033, 47324, 46382, 43690, 36152, 34622, 33543, 32768, 32768, 32768,
+     32768, 32768, 28128, 25586, 24702, 24576, 24450, 23566, 21023, 16384, 16384, 16384, 16384,
+     16384, 16190, 15920, 15538, 13653, 12980, 12745, 12567, 12353, 12288, 12288},
+    {49151, 49151, 48521, 46891, 45875, 44814, 42758, 37235, 35675, 34222, 32768, 32768, 32768,
+     32768, 32768, 28128, 25586, 24702, 24576, 24450, 23566, 21023, 16384, 16384, 16384, 16384,
+     16384, 16020, 15657, 15267, 13886, 13372, 13107, 12853, 12445, 12288, 12288},
+    {49151, 49151, 45875, 40959, 40959, 40959, 40959, 40959, 40959, 38968, 32768, 32768, 32768,
+     32768, 32768, 28128, 25586, 25058, 24576, 24094, 23566, 21023, 16384, 16384, 16384, 16384,
+     16384, 14834, 14336, 14336, 14336, 14336, 14336, 14336, 13107, 12288, 12288},
+    {45118, 45118, 39693, 37935, 37935, 37935, 37935, 37935, 37935, 36997, 30751, 30751, 30751,
+     30751, 28672, 24032, 23885, 23229, 22559, 21658, 20776, 17816, 14336, 15376, 15376, 15376,
+     15376, 13414, 13328, 13328, 13328, 13328, 13328, 13328, 12288, 11280, 11280},
+    {38666, 38666, 36243, 33095, 33095, 33095, 33095, 33095, 33095, 33142, 27525, 27525, 27525,
+     27772, 28672, 24032, 20757, 20025, 19333, 18963, 18571, 17816, 14336, 13886, 13762, 13762,
+     13762, 12218, 11714, 11714, 11714, 11714, 11714, 11714, 10798, 9666, 9666},
+    {33731, 33731, 33199, 32023, 31332, 30644, 29394, 28578, 27865, 27155, 25058, 25058, 25532,
+     26390, 28672, 24032, 19978, 17203, 16866, 16793, 17345, 17816, 14336, 13195, 12766, 12529,
+     12529, 12000, 11519, 11035, 10481, 10012, 9754, 9495, 9054, 8433, 8433},
+    {32768, 32768, 32637, 32209, 31854, 31383, 30037, 26268, 25503, 24964, 24576, 24576, 24576,
+     24576, 24576, 19936, 17394, 16510, 16384, 16321, 15879, 14608, 12288, 12288, 12288, 12288,
+     12288, 12094, 11824, 11442, 9557, 8884, 8649, 8471, 8257, 8192, 8192},
+    {32286, 32286, 31043, 30161, 29643, 29127, 28190, 27081, 26114, 25151, 24094, 24094, 23619,
+     22762, 20480, 17000, 16467, 16267, 16143, 15974, 14587, 12560, 10240, 11381, 11809, 12047,
+     12047, 11319, 10923, 10526, 10071, 9497, 9180, 8862, 8321, 8096, 8096},
+    {29818, 29818, 27554, 25722, 25722, 25722, 25722, 25722, 25722, 24715, 21627, 21627, 21627,
+     21379, 20480, 17000, 15759, 15322, 14909, 14563, 14197, 12560, 10240, 10689, 10813, 10813,
+     10813, 9353, 9208, 9208, 9208, 9208, 9208, 9208, 8242, 7602, 7602},
+    {26592, 26592, 24576, 22496, 22496, 22496, 22496, 22496, 22496, 22322, 18400, 18400, 18400,
+     18400, 20480, 17000, 14854, 14083, 13296, 12961, 12633, 12560, 10240, 9200, 9200, 9200,
+     9200, 8206, 8078, 8078, 8078, 8078, 8078, 8078, 8040, 6957, 6957},
+    {24576, 24576, 22937, 20480, 20480, 20480, 20480, 20480, 20480, 19484, 16384, 16384, 16384,
+     16384, 16384, 14064, 12793, 12529, 12288, 12047, 11783, 10512, 8192, 8192, 8192, 8192,
+     8192, 7572, 7373, 7373, 7373, 7373, 7373, 7373, 6881, 6554, 6554},
+    {24576, 24576, 24261, 23446, 22937, 22407, 21379, 18617, 17837, 17111, 16384, 16384, 16384,
+     16384, 16384, 14064, 12793, 12351, 12288, 12225, 11783, 10512, 8192, 8192, 8192, 8192,
+     8192, 8046, 7901, 7745, 7193, 6987, 6881, 6779, 6617, 6554, 6554},
+    {24576, 24576, 24445, 24017, 23662, 23191, 21845, 18076, 17311, 16772, 16384, 16384, 16384,
+     16384, 16384, 14064, 12793, 12351, 12288, 12225, 11783, 10512, 8192, 8192, 8192, 8192,
+     8192, 8114, 8006, 7853, 7100, 6830, 6736, 6665, 6580, 6554, 6554},
+    {24487, 24487, 24220, 23818, 23462, 22991, 21657, 17977, 17236, 16715, 16339, 16263, 16076,
+     15774, 14824, 12494, 12250, 12200, 12244, 11997, 10886, 9223, 7568, 7948, 8069, 8144,
+     8174, 8049, 7939, 7787, 7055, 6796, 6706, 6638, 6556, 6527, 6527},
+    {24366, 24366, 24008, 23547, 23225, 22755, 21437, 17862, 17148, 16648, 16279, 16123, 15752,
+     15230, 14336, 12016, 11774, 12029, 12183, 11835, 10570, 8997, 7373, 7731, 7939, 8087,
+     8150, 7972, 7860, 7709, 7003, 6756, 6670, 6607, 6522, 6491, 6491},
+    {24188, 24188, 23819, 23147, 22894, 22449, 21153, 17713, 17035, 16561, 16190, 15944, 15386,
+     14707, 14336, 12016, 11273, 11815, 12094, 11631, 10237, 8997, 7373, 7521, 7793, 8016,
+     8114, 7873, 7758, 7608, 6936, 6704, 6624, 6563, 6472, 6437, 6437},
+    {22883, 22883, 22523, 21602, 21037, 20456, 19736, 16982, 16487, 16017, 15538, 15088, 14336,
+     14336, 14336, 12016, 10745, 10844, 11442, 10709, 9886, 8997, 7373, 7373, 7373, 7673,
+     7853, 7608, 7368, 7114, 6601, 6423, 6332, 6245, 6102, 6046, 6046},
+    {19114, 19114, 18923, 18432, 18127, 17811, 17203, 15570, 14906, 14282, 13653, 14096, 14336,
+     14336, 14336, 12016, 10745, 10303, 9557, 10196, 9886, 8997, 7373, 7373, 7373, 7277,
+     7100, 6936, 6774, 6601, 5898, 5585, 5423, 5266, 5013, 4915, 4915},
+    {17768, 17768, 17644, 17320, 17116, 16901, 16508, 15220, 14306, 13609, 12980, 13548, 14336,
+     14336, 14336, 12016, 10745, 9758, 8884, 9621, 9886, 8997, 7373, 7373, 7373, 7058,
+     6830, 6704, 6578, 6423, 5585, 5234, 5055, 4885, 4615, 4511, 4511},
+    {16943, 16943, 16857, 16630, 16496, 16317, 15799, 14235, 13863, 13261, 12567, 12963, 13705,
+     14336, 14336, 12016, 10745, 9141, 8471, 8971, 9886, 8997, 7373, 7373, 7120, 6824,
+     6665, 6563, 6433, 6245, 5266, 4885, 4745, 4637, 4366, 4264, 4264},
+    {16687, 16687, 16612, 16416, 16265, 16065, 15487, 13797, 13418, 13125, 12439, 12697, 13227,
+     13886, 14336, 12016, 10379, 8847, 8343, 8662, 9317, 8997, 7373, 7193, 6929, 6717,
+     6614, 6512, 6370, 6166, 5126, 4734, 4593, 4485, 4288, 4187, 4187},
+    {16515, 16515, 16447, 16249, 16084, 15865, 15237, 13444, 13063, 12781, 12353, 12481, 12766,
+     13195, 14336, 12016, 9989, 8601, 8257, 8403, 8710, 8997, 7373, 6916, 6745, 6631,
+     6580, 6472, 6320, 6102, 5013, 4615, 4474, 4366, 4236, 4135, 4135},
+    {16416, 16416, 16351, 16141, 15967, 15736, 15075, 13214, 12832, 12559, 12304, 12338, 12419,
+     12560, 13107, 10932, 9254, 8436, 8208, 8229, 8212, 8090, 6881, 6662, 6606, 6573,
+     6560, 6446, 6287, 6060, 4940, 4538, 4397, 4290, 4161, 4106, 4106},
+    {16384, 16384, 16318, 16104, 15927, 15691, 15018, 13134, 12751, 12482, 12288, 12288, 12288,
+     12288, 12288, 9968, 8697, 8255, 8192, 8167, 7990, 7481, 6554, 6554, 6554, 6553,
+     6554, 6437, 6275, 6046, 4915, 4511, 4370, 4264, 4135, 4096, 4096},
+    {16384, 16384, 16318, 16104, 15927, 15691, 15018, 13134, 12751, 12482, 12288, 12288, 12288,
+     12288, 12288, 9968, 8697, 8255, 8192, 8167, 7990, 7481, 6554, 6554, 6554, 6553,
+     6554, 6437, 6275, 6046, 4915, 4511, 4370, 4264, 4135, 4096, 4096}
+};
+
+static const uint16_t fuzzy_surface_ki_t12[FUZZY_SURFACE_E_POINTS][FUZZY_SURFACE_DE_POINTS] = {
+    {65535, 65535, 65273, 64417, 63707, 62766, 60074, 52536, 51006, 49927, 49151, 49151, 49151,
+     49151, 49151, 39872, 34787, 33020, 32768, 32515, 30748, 25663, 16384, 16384, 16384, 16384,
+     16384, 15996, 15456, 14692, 10923, 9577, 9106, 8751, 8323, 8192, 8192},
+    {65535, 65535, 65273, 64417, 63707, 62766, 60074, 52536, 51006, 49927, 49151, 49151, 49151,
+     49151, 49151, 39872, 34787, 33020, 32768, 32515, 30748, 25663, 16384, 16384, 16384, 16384,
+     16384, 15996, 15456, 14692, 10923, 9577, 9106, 8751, 8323, 8192, 8192},
+    {65471, 65471, 65080, 64219, 63506, 62563, 59877, 52409, 50901, 49841, 49087, 48951, 48627,
+     48064, 45874, 36496, 33779, 32768, 32703, 31973, 29127, 23163, 15565, 16112, 16253, 16334,
+     16368, 15933, 15394, 14634, 10907, 9575, 9108, 8756, 8332, 8185, 8185},
+    {65273, 65273, 64520, 63643, 62923, 61976, 59309, 52047, 50601, 49591, 48889, 48380, 47238,
+     45523, 40959, 31680, 31597, 32065, 32506, 31305, 26707, 20135, 14336, 15477, 15905, 16191,
+     16318, 15750, 15213, 14469, 10862, 9571, 9117, 8773, 8357, 8166, 8166},
+    {64929, 64929, 64167, 62745, 62016, 61066, 58435, 51491, 50139, 49206, 48546, 47513, 45394,
+     42758, 40959, 31680, 29019, 31020, 32162, 30310, 24957, 20135, 14336, 14785, 15445, 15974,
+     16232, 15467, 14936, 14216, 10794, 9564, 9129, 8799, 8329, 8131, 8131},
+    {64417, 64417, 63643, 61601, 60865, 59917, 57343, 50800, 49561, 48708, 48033, 46449, 43483,
+     40959, 40959, 31680, 26596, 29770, 31650, 29121, 23313, 20135, 14336, 14336, 14967, 15708,
+     16104, 15342, 14589, 13902, 10708, 9556, 9145, 8831, 8286, 8080, 8080},
+    {62766, 62766, 61976, 59917, 58620, 57256, 54861, 49248, 48199, 47301, 46382, 44110, 40959,
+     40959, 40959, 31680, 26596, 27146, 29998, 26624, 23313, 20135, 14336, 14336, 14336, 15123,
+     15691, 14994, 14223, 13194, 10513, 9537, 9136, 8754, 8147, 7915, 7915},
+    {60074, 60074, 59309, 57343, 56124, 54861, 52428, 47524, 46195, 44948, 43690, 41920, 40959,
+     40959, 40959, 31680, 26596, 24828, 27306, 24418, 23313, 20135, 14336, 14336, 14336, 14576,
+     15018, 14314, 13616, 12871, 10322, 9470, 9028, 8601, 7913, 7646, 7646},
+    {52536, 52536, 52047, 50800, 50035, 49248, 47524, 42347, 40222, 38207, 36152, 37951, 40959,
+     40959, 40959, 31680, 26596, 22794, 19768, 22279, 23313, 20135, 14336, 14336, 14336, 13584,
+     13134, 12575, 12027, 11450, 9539, 9006, 8500, 8008, 7206, 6892, 6892},
+    {49927, 49927, 49591, 48708, 48112, 47301, 44948, 38207, 36730, 35603, 33543, 34527, 36759,
+     39473, 40959, 31680, 25319, 19140, 17160, 18437, 21357, 20135, 14336, 13964, 13286, 12728,
+     12482, 12040, 11699, 11218, 8817, 7922, 7614, 7433, 6919, 6631, 6631},
+    {49570, 49570, 49262, 48427, 47793, 46921, 44431, 37365, 35864, 34754, 33186, 33811, 35293,
+     37381, 40959, 31680, 24107, 18334, 16802, 17589, 19501, 20135, 14336, 13441, 12919, 12549,
+     12392, 12030, 11674, 11171, 8673, 7757, 7432, 7207, 6872, 6595, 6595},
+    {49328, 49328, 49043, 48225, 47539, 46629, 44031, 36711, 35194, 34099, 32945, 33250, 33999,
+     35206, 39006, 30661, 22956, 17690, 16561, 16913, 17737, 18700, 13847, 12898, 12596, 12409,
+     12332, 12023, 11655, 11135, 8560, 7630, 7303, 7055, 6772, 6571, 6571},
+    {49151, 49151, 48889, 48033, 47324, 46382, 43690, 36152, 34622, 33543, 32768, 32767, 32768,
+     32768, 32768, 23488, 18404, 16636, 16384, 16321, 15879, 14608, 12288, 12288, 12288, 12288,
+     12288, 12016, 11639, 11103, 8465, 7523, 7193, 6945, 6645, 6554, 6554},
+    {49151, 49151, 48521, 46891, 45875, 44814, 42758, 37235, 35675, 34222, 32768, 32767, 32768,
+     32768, 32768, 23488, 18404, 16636, 16384, 16321, 15879, 14608, 12288, 12288, 12288, 12288,
+     12288, 11779, 11270, 10724, 8791, 8071, 7700, 7344, 6774, 6554, 6554},
+    {49151, 49151, 45874, 40959, 40959, 40959, 40959, 40959, 40959, 38968, 32768, 32768, 32768,
+     32768, 32768, 23488, 18404, 17348, 16384, 16143, 15879, 14608, 12288, 12288, 12288, 12288,
+     12288, 10117, 9421, 9421, 9421, 9421, 9421, 9421, 7700, 6554, 6554},
+    {45118, 45118, 38341, 36926, 36926, 36926, 36926, 36926, 36926, 35905, 28735, 28735, 28735,
+     28735, 24576, 17616, 16581, 15486, 14367, 13825, 13295, 11045, 9421, 10876, 10876, 10876,
+     10876, 8568, 8412, 8412, 8412, 8412, 8412, 8412, 7094, 5949, 5949},
+    {38666, 38666, 35250, 30474, 30474, 30474, 30474, 30474, 30474, 30146, 22282, 22282, 22282,
+     22777, 24576, 17616, 13190, 12136, 11141, 11014, 10879, 11045, 9421, 8791, 8618, 8618,
+     8618, 7186, 6799, 6799, 6799, 6799, 6799, 6799, 6057, 4981, 4981},
+    {33731, 33731, 32768, 30533, 29221, 27913, 25539, 23789, 22262, 20742, 17348, 17348, 18297,
+     20012, 24576, 17616, 12539, 9128, 8674, 8695, 9755, 11045, 9421, 7823, 7223, 6891,
+     6891, 6541, 6232, 5922, 5566, 5310, 5168, 5027, 4786, 4241, 4241},
+    {32768, 32768, 32506, 31650, 30940, 29998, 27306, 19768, 18238, 17160, 16384, 16384, 16384,
+     16384, 16384, 11744, 9202, 8318, 8192, 8167, 7990, 7481, 6554, 6554, 6554, 6554,
+     6554, 6437, 6275, 6046, 4915, 4511, 4370, 4264, 4135, 4096, 4096},
+    {31804, 31804, 29965, 28113, 27025, 25941, 23973, 21844, 19986, 18136, 16143, 16143, 15905,
+     15477, 14336, 10392, 9053, 8274, 8096, 8016, 7398, 6485, 5325, 6009, 6266, 6409,
+     6409, 5940, 5707, 5473, 5204, 4854, 4662, 4468, 4139, 4000, 4000},
+    {26869, 26869, 23831, 20889, 20889, 20889, 20889, 20889, 20889, 19190, 14909, 14909, 14909,
+     14785, 14336, 10392, 8629, 8101, 7602, 7433, 7255, 6485, 5325, 5594, 5669, 5669,
+     5669, 4658, 4587, 4587, 4587, 4587, 4587, 4587, 3947, 3506, 3506},
+    {20417, 20417, 18411, 16856, 16856, 16856, 16856, 16856, 16856, 16896, 13296, 13296, 13296,
+     13296, 14336, 10392, 8557, 7765, 6957, 6778, 6603, 6485, 5325, 4701, 4701, 4701,
+     4701, 3891, 3781, 3781, 3781, 3781, 3781, 3781, 3674, 2861, 2861},
+    {16384, 16384, 15565, 14336, 14336, 14336, 14336, 14336, 14336, 13838, 12288, 12288, 12288,
+     12288, 12288, 9040, 7260, 6891, 6554, 6409, 6251, 5488, 4096, 4096, 4096, 4096,
+     4096, 3476, 3277, 3277, 3277, 3277, 3277, 3277, 2785, 2458, 2458},
+    {16384, 16384, 16226, 15819, 15565, 15300, 14785, 13405, 13015, 12651, 12288, 12288, 12288,
+     12288, 12288, 9040, 7260, 6642, 6554, 6516, 6251, 5488, 4096, 4096, 4096, 4096,
+     4096, 3950, 3805, 3649, 3097, 2891, 2785, 2684, 2521, 2458, 2458},
+    {16384, 16384, 16318, 16104, 15927, 15691, 15018, 13134, 12751, 12482, 12288, 12288, 12288,
+     12288, 12288, 9040, 7260, 6642, 6554, 6516, 6251, 5488, 4096, 4096, 4096, 4096,
+     4096, 4018, 3910, 3757, 3004, 2734, 2640, 2569, 2484, 2458, 2458},
+    {16295, 16295, 16124, 15925, 15743, 15504, 14827, 12982, 12616, 12362, 12226, 12119, 11857,
+     11434, 10104, 7515, 6852, 6549, 6527, 6369, 5648, 4580, 3472, 3852, 3973, 4048,
+     4078, 3972, 3864, 3712, 2980, 2719, 2628, 2559, 2477, 2449, 2449},
+    {16174, 16174, 15933, 15689, 15526, 15282, 14603, 12804, 12457, 12222, 12141, 11922, 11404,
+     10673, 9421, 7101, 6529, 6444, 6491, 6272, 5466, 4437, 3277, 3635, 3843, 3992,
+     4054, 3918, 3809, 3660, 2952, 2701, 2613, 2549, 2467, 2437, 2437},
+    {15996, 15996, 15750, 15342, 15228, 14994, 14314, 12575, 12252, 12040, 12016, 11672, 10891,
+     9941, 9421, 7101, 6188, 6313, 6437, 6151, 5274, 4437, 3277, 3425, 3697, 3920,
+     4018, 3848, 3738, 3592, 2916, 2677, 2595, 2536, 2451, 2419, 2419},
+    {14692, 14692, 14469, 13902, 13553, 13194, 12871, 11450, 11331, 11218, 11103, 10473, 9421,
+     9421, 9421, 7101, 5830, 5719, 6046, 5600, 5072, 4437, 3277, 3277, 3277, 3578,
+     3757, 3592, 3429, 3258, 2735, 2569, 2502, 2436, 2330, 2288, 2288},
+    {10923, 10923, 10862, 10708, 10612, 10513, 10322, 9539, 9166, 8817, 8465, 9085, 9421,
+     9421, 9421, 7101, 5830, 5388, 4915, 5293, 5072, 4437, 3277, 3277, 3277, 3181,
+     3004, 2916, 2828, 2735, 2458, 2284, 2194, 2106, 1966, 1911, 1911},
+    {9577, 9577, 9571, 9556, 9547, 9537, 9470, 9006, 8382, 7922, 7523, 8318, 9421,
+     9421, 9421, 7101, 5830, 5068, 4511, 4947, 5072, 4437, 3277, 3277, 3277, 2962,
+     2734, 2677, 2624, 2569, 2284, 2156, 2062, 1973, 1831, 1777, 1777},
+    {8751, 8751, 8773, 8831, 8800, 8754, 8601, 8008, 7831, 7433, 6945, 7499, 8537,
+     9421, 9421, 7101, 5830, 4705, 4264, 4555, 5072, 4437, 3277, 3277, 3024, 2728,
+     2569, 2536, 2496, 2436, 2106, 1973, 1923, 1884, 1746, 1694, 1694},
+    {8495, 8495, 8524, 8526, 8479, 8415, 8219, 7564, 7395, 7251, 6766, 7127, 7868,
+     8791, 9421, 7101, 5658, 4533, 4187, 4369, 4721, 4437, 3277, 3097, 2833, 2621,
+     2518, 2488, 2444, 2378, 2028, 1894, 1845, 1807, 1720, 1669, 1669},
+    {8323, 8323, 8357, 8286, 8227, 8147, 7913, 7206, 7045, 6919, 6645, 6823, 7223,
+     7823, 9421, 7101, 5475, 4389, 4135, 4213, 4347, 4437, 3277, 2820, 2649, 2535,
+     2484, 2451, 2402, 2330, 1966, 1831, 1783, 1746, 1702, 1651, 1651},
+    {8224, 8224, 8215, 8133, 8065, 7975, 7715, 6973, 6818, 6705, 6576, 6623, 6737,
+     6934, 7700, 6102, 4895, 4292, 4106, 4108, 4035, 3813, 2785, 2566, 2510, 2478,
+     2464, 2427, 2374, 2299, 1926, 1791, 1743, 1708, 1664, 1642, 1642},
+    {8192, 8192, 8166, 8080, 8009, 7915, 7646, 6892, 6739, 6631, 6554, 6554, 6554,
+     6554, 6554, 5162, 4399, 4134, 4096, 4071, 3894, 3385, 2458, 2458, 2458, 2458,
+     2458, 2419, 2365, 2288, 1911, 1777, 1730, 1694, 1651, 1638, 1638},
+    {8192, 8192, 8166, 8080, 8009, 7915, 7646, 6892, 6739, 6631, 6554, 6554, 6554,
+     6554, 6554, 5162, 4399, 4134, 4096, 4071, 3894, 3385, 2458, 2458, 2458, 2458,
+     2458, 2419, 2365, 2288, 1911, 1777, 1730, 1694, 1651, 1638, 1638}
+};
+
+static const uint16_t fuzzy_surface_kd_t12[FUZZY_SURFACE_E_POINTS][FUZZY_SURFACE_DE_POINTS] = {
+    {6554, 6554, 6658, 7001, 7285, 7661, 8738, 11753, 12365, 12797, 13107, 13107, 13107,
+     13107, 13107, 16819, 18853, 19560, 19661, 19761, 20468, 22502, 26214, 26214, 26214, 26214,
+     26214, 26524, 26956, 27568, 30583, 31660, 32036, 32320, 32663, 32768, 32768},
+    {6554, 6554, 6658, 7001, 7285, 7661, 8738, 11753, 12365, 12797, 13107, 13107, 13107,
+     13107, 13107, 16819, 18853, 19560, 19661, 19761, 20468, 22502, 26214, 26214, 26214, 26214,
+     26214, 26524, 26956, 27568, 30583, 31660, 32036, 32320, 32663, 32768, 32768},
+    {6579, 6579, 6735, 7080, 7365, 7742, 8817, 11804, 12407, 12831, 13133, 13187, 13317,
+     13542, 14418, 18169, 19256, 19661, 19686, 20052, 21360, 24045, 27525, 26649, 26424, 26294,
+     26240, 26616, 27050, 27660, 30639, 31701, 32072, 32352, 32690, 32793, 32793},
+    {6658, 6658, 6960, 7310, 7598, 7977, 9044, 11949, 12527, 12931, 13212, 13415, 13872,
+     14558, 16384, 20095, 20129, 19941, 19765, 20316, 22536, 25779, 29491, 27665, 26979, 26522,
+     26319, 26881, 27322, 27926, 30801, 31819, 32175, 32443, 32768, 32872, 32872},
+    {6796, 6796, 7101, 7669, 7961, 8341, 9393, 12171, 12712, 13085, 13349, 13762, 14610,
+     15664, 16384, 20095, 21160, 20360, 19903, 20709, 23159, 25779, 29491, 28771, 27717, 26869,
+     26456, 27290, 27740, 28333, 31051, 32001, 32334, 32586, 32898, 33010, 33010},
+    {7001, 7001, 7310, 8127, 8421, 8801, 9830, 12447, 12943, 13284, 13554, 14188, 15374,
+     16384, 16384, 20095, 22129, 20859, 20108, 21179, 23745, 25779, 29491, 29491, 28481, 27295,
+     26661, 27494, 28263, 28838, 31363, 32232, 32537, 32768, 33092, 33215, 33215},
+    {7661, 7661, 7977, 8801, 9320, 9865, 10823, 13068, 13488, 13847, 14215, 15123, 16384,
+     16384, 16384, 20095, 22129, 21909, 20768, 22166, 23745, 25779, 29491, 29491, 29491, 28230,
+     27322, 28053, 28874, 29975, 32072, 32768, 33042, 33303, 33716, 33875, 33875},
+    {8738, 8738, 9044, 9830, 10318, 10823, 11796, 13758, 14289, 14788, 15292, 16000, 16384,
+     16384, 16384, 20095, 22129, 22836, 21845, 23038, 23745, 25779, 29491, 29491, 29491, 29107,
+     28399, 29103, 29801, 30546, 32768, 33463, 33824, 34172, 34734, 34952, 34952},
+    {11753, 11753, 11949, 12447, 12753, 13068, 13758, 15829, 16679, 17485, 18307, 17587, 16384,
+     16384, 16384, 20095, 22129, 23650, 24860, 23903, 23745, 25779, 29491, 29491, 29491, 30694,
+     31414, 31863, 32303, 32768, 34989, 35560, 36136, 36697, 37609, 37967, 37967},
+    {12797, 12797, 12931, 13284, 13523, 13847, 14788, 17485, 18076, 18526, 19350, 18957, 18064,
+     16978, 16384, 20095, 22640, 25111, 25904, 25457, 24590, 25779, 29491, 30085, 31171, 32064,
+     32457, 32768, 33137, 33672, 36432, 37482, 37843, 38041, 38654, 39011, 39011},
+    {12940, 12940, 13063, 13397, 13650, 13999, 14995, 17821, 18422, 18866, 19493, 19243, 18650,
+     17815, 16384, 20095, 23125, 25434, 26047, 25801, 25392, 25779, 29491, 30922, 31757, 32350,
+     32600, 32895, 33290, 33856, 36721, 37784, 38163, 38422, 38808, 39154, 39154},
+    {13036, 13036, 13150, 13478, 13752, 14116, 15155, 18083, 18690, 19128, 19590, 19467, 19168,
+     18685, 17165, 20503, 23585, 25691, 26143, 26074, 26154, 26544, 30272, 31792, 32275, 32574,
+     32697, 32994, 33408, 33999, 36946, 38016, 38395, 38681, 39002, 39250, 39250},
+    {13107, 13107, 13212, 13554, 13838, 14215, 15292, 18307, 18919, 19350, 19661, 19661, 19661,
+     19661, 19661, 23372, 25406, 26113, 26214, 26315, 27022, 29056, 32768, 32768, 32768, 32768,
+     32768, 33078, 33509, 34121, 37137, 38213, 38590, 38874, 39216, 39321, 39321},
+    {13107, 13107, 13359, 14011, 14418, 14842, 15664, 17874, 18498, 19079, 19661, 19661, 19661,
+     19661, 19661, 23372, 25406, 26113, 26214, 26315, 27022, 29056, 32768, 32768, 32768, 32768,
+     32768, 33349, 33930, 34554, 36764, 37586, 38010, 38417, 39069, 39321, 39321},
+    {13107, 13107, 14418, 16384, 16384, 16384, 16384, 16384, 16384, 17180, 19661, 19661, 19661,
+     19661, 19661, 23372, 25406, 25829, 26214, 26600, 27022, 29056, 32768, 32768, 32768, 32768,
+     32768, 35248, 36044, 36044, 36044, 36044, 36044, 36044, 38010, 39321, 39321},
+    {14720, 14720, 17431, 17997, 17997, 17997, 17997, 17997, 17997, 18406, 21274, 21274, 21274,
+     21274, 22937, 26649, 26767, 27291, 27827, 28728, 29609, 32333, 36044, 34381, 34381, 34381,
+     34381, 37518, 37657, 37657, 37657, 37657, 37657, 37657, 39321, 40934, 40934},
+    {17301, 17301, 18668, 20578, 20578, 20578, 20578, 20578, 20578, 20709, 23855, 23855, 23855,
+     23657, 22937, 26649, 29269, 29855, 30408, 30826, 31268, 32333, 36044, 36764, 36962, 36962,
+     36962, 39432, 40238, 40238, 40238, 40238, 40238, 40238, 41704, 43515, 43515},
+    {19275, 19275, 19661, 20554, 21079, 21602, 22552, 23252, 23863, 24471, 25829, 25829, 25449,
+     24763, 22937, 26649, 29892, 32112, 32382, 32487, 32299, 32333, 36044, 37870, 38556, 38936,
+     38936, 39781, 40552, 41326, 42212, 42962, 43375, 43789, 44495, 45489, 45489},
+    {19661, 19661, 19765, 20108, 20392, 20768, 21845, 24860, 25472, 25904, 26214, 26214, 26214,
+     26214, 26214, 29926, 31960, 32667, 32768, 32868, 33575, 35609, 39321, 39321, 39321, 39321,
+     39321, 39631, 40063, 40675, 43690, 44767, 45143, 45427, 45770, 45875, 45875},
+    {20046, 20046, 21040, 21746, 22160, 22573, 23323, 24209, 24983, 25754, 26600, 26600, 26979,
+     27665, 29491, 33202, 33236, 33048, 33153, 33423, 35643, 38886, 42598, 40772, 40086, 39707,
+     39707, 41064, 41672, 42283, 42983, 43933, 44456, 44981, 45875, 46260, 46260},
+    {22020, 22020, 23831, 25297, 25297, 25297, 25297, 25297, 25297, 26103, 28573, 28573, 28573,
+     28771, 29491, 33202, 34267, 34709, 35127, 35680, 36266, 38886, 42598, 41878, 41680, 41680,
+     41680, 44826, 44957, 44957, 44957, 44957, 44957, 44957, 46867, 48234, 48234},
+    {24601, 24601, 26214, 27878, 27878, 27878, 27878, 27878, 27878, 28017, 31154, 31154, 31154,
+     31154, 29491, 33202, 35926, 36807, 37708, 38244, 38768, 38886, 42598, 44261, 44261, 44261,
+     44261, 47129, 47538, 47538, 47538, 47538, 47538, 47538, 48104, 50815, 50815},
+    {26214, 26214, 27525, 29491, 29491, 29491, 29491, 29491, 29491, 30287, 32768, 32768, 32768,
+     32768, 32768, 36479, 38513, 38936, 39321, 39707, 40129, 42163, 45875, 45875, 45875, 45875,
+     45875, 48355, 49151, 49151, 49151, 49151, 49151, 49151, 51117, 52428, 52428},
+    {26214, 26214, 26466, 27118, 27525, 27949, 28771, 30981, 31605, 32186, 32768, 32768, 32768,
+     32768, 32768, 36479, 38513, 39220, 39321, 39422, 40129, 42163, 45875, 45875, 45875, 45875,
+     45875, 46456, 47037, 47661, 49871, 50693, 51117, 51524, 52176, 52428, 52428},
+    {26214, 26214, 26319, 26661, 26945, 27322, 28399, 31414, 32026, 32457, 32768, 32768, 32768,
+     32768, 32768, 36479, 38513, 39220, 39321, 39422, 40129, 42163, 45875, 45875, 45875, 45875,
+     45875, 46185, 46616, 47228, 50244, 51320, 51697, 51981, 52323, 52428, 52428},
+    {26285, 26285, 26533, 26854, 27140, 27519, 28589, 31536, 32127, 32541, 32838, 32961, 33260,
+     33743, 35263, 38991, 39381, 39461, 39392, 39844, 41950, 45032, 48370, 46850, 46367, 46068,
+     45945, 46484, 46927, 47538, 50462, 51493, 51853, 52125, 52454, 52570, 52570},
+    {26381, 26381, 26727, 27113, 27372, 27751, 28814, 31679, 32245, 32640, 32935, 33185, 33778,
+     34613, 36044, 39756, 40143, 39734, 39488, 40101, 42410, 45440, 49151, 47720, 46885, 46292,
+     46042, 46836, 47292, 47901, 50718, 51697, 52038, 52291, 52634, 52763, 52763},
+    {26524, 26524, 26881, 27494, 27692, 28053, 29103, 31863, 32398, 32768, 33078, 33471, 34364,
+     35450, 36044, 39756, 40945, 40078, 39631, 40424, 42895, 45440, 49151, 48557, 47471, 46578,
+     46185, 47292, 47763, 48368, 51049, 51962, 52278, 52527, 52903, 53049, 53049},
+    {27568, 27568, 27926, 28838, 29399, 29975, 30546, 32768, 33232, 33672, 34121, 34841, 36044,
+     36044, 36044, 39756, 41790, 41632, 40675, 41885, 43406, 45440, 49151, 49151, 49151, 47948,
+     47228, 48368, 49486, 50664, 52698, 53436, 53843, 54239, 54883, 55136, 55136},
+    {30583, 30583, 30801, 31363, 31711, 32072, 32768, 34989, 35734, 36432, 37137, 36428, 36044,
+     36044, 36044, 39756, 41790, 42497, 43690, 42699, 43406, 45440, 49151, 49151, 49151, 49535,
+     50244, 51049, 51847, 52698, 56360, 57889, 58684, 59450, 60685, 61166, 61166},
+    {31660, 31660, 31819, 32232, 32493, 32767, 33463, 35560, 36661, 37482, 38213, 37305, 36044,
+     36044, 36044, 39756, 41790, 43369, 44767, 43626, 43406, 45440, 49151, 49151, 49151, 50412,
+     51320, 51962, 52617, 53436, 57889, 59740, 60626, 61469, 62807, 63320, 63320},
+    {32320, 32320, 32443, 32768, 32998, 33303, 34172, 36697, 37272, 38041, 38874, 38240, 37054,
+     36044, 36044, 39756, 41790, 44356, 45427, 44676, 43406, 45440, 49151, 49151, 50161, 51347,
+     51981, 52527, 53227, 54239, 59450, 61469, 62209, 62781, 64130, 64641, 64641},
+    {32525, 32525, 32637, 32949, 33201, 33534, 34484, 37202, 37795, 38245, 39079, 38666, 37818,
+     36764, 36044, 39756, 42376, 44826, 45632, 45175, 44375, 45440, 49151, 49871, 50925, 51773,
+     52186, 52735, 53501, 54596, 60136, 62215, 62964, 63537, 64545, 65050, 65050},
+    {32663, 32663, 32768, 33092, 33360, 33716, 34734, 37609, 38213, 38654, 39216, 39013, 38556,
+     37870, 36044, 39756, 42999, 45219, 45770, 45594, 45406, 45440, 49151, 50977, 51663, 52120,
+     52323, 52903, 53720, 54883, 60685, 62807, 63559, 64130, 64824, 65326, 65326},
+    {32742, 32742, 32845, 33183, 33463, 33834, 34896, 37875, 38485, 38919, 39295, 39241, 39111,
+     38886, 38010, 41490, 44175, 45483, 45849, 45875, 46279, 47366, 51117, 51993, 52218, 52348,
+     52402, 53011, 53862, 55070, 61042, 63188, 63941, 64510, 65197, 65484, 65484},
+    {32768, 32768, 32872, 33215, 33499, 33875, 34952, 37967, 38579, 39011, 39321, 39321, 39321,
+     39321, 39321, 43033, 45067, 45774, 45875, 45975, 46682, 48716, 52428, 52428, 52428, 52428,
+     52428, 53049, 53912, 55136, 61166, 63320, 64073, 64641, 65326, 65535, 65535},
+    {32768, 32768, 32872, 33215, 33499, 33875, 34952, 37967, 38579, 39011, 39321, 39321, 39321,
+     39321, 39321, 43033, 45067, 45774, 45875, 45975, 46682, 48716, 52428, 52428, 52428, 52428,
+     52428, 53049, 53912, 55136, 61166, 63320, 64073, 64641, 65326, 65535, 65535}
+};
+
+static const uint16_t fuzzy_surface_kp_hot_air[FUZZY_SURFACE_E_POINTS][FUZZY_SURFACE_DE_POINTS] = {
+    {32768, 32768, 32637, 32209, 31854, 31383, 30037, 26268, 25503, 24964, 24576, 24576, 24576,
+     24576, 24576, 19936, 17394, 16510, 16384, 16321, 15879, 14608, 12288, 12288, 12288, 12288,
+     12288, 12094, 11824, 11442, 9557, 8884, 8649, 8471, 8257, 8192, 8192},
+    {32768, 32768, 32637, 32209, 31854, 31383, 30037, 26268, 25503, 24964, 24576, 24576, 24576,
+     24576, 24576, 19936, 17394, 16510, 16384, 16321, 15879, 14608, 12288, 12288, 12288, 12288,
+     12288, 12094, 11824, 11442, 9557, 8884, 8649, 8471, 8257, 8192, 8192},
+    {32735, 32735, 32540, 32109, 31753, 31281, 29938, 26205, 25451, 24920, 24543, 24476, 24313,
+     24032, 22937, 18700, 17092, 16445, 16368, 16139, 15322, 13644, 11469, 12016, 12157, 12238,
+     12272, 12048, 11778, 11397, 9535, 8870, 8637, 8462, 8250, 8185, 8185},
+    {32637, 32637, 32260, 31822, 31462, 30988, 29655, 26023, 25301, 24796, 24445, 24190, 23619,
+     22762, 20480, 17000, 16467, 16267, 16318, 15974, 14587, 12560, 10240, 11381, 11809, 12095,
+     12222, 11917, 11645, 11270, 9470, 8829, 8605, 8435, 8230, 8166, 8166},
+    {32465, 32465, 32083, 31373, 31008, 30533, 29218, 25746, 25069, 24603, 24273, 23756, 22697,
+     21379, 20480, 17000, 15759, 16001, 16232, 15728, 14197, 12560, 10240, 10689, 11349, 11878,
+     12136, 11714, 11440, 11075, 9370, 8766, 8554, 8393, 8198, 8131, 8131},
+    {32209, 32209, 31822, 30800, 30433, 29959, 28672, 25400, 24781, 24354, 24017, 23224, 21742,
+     20480, 20480, 17000, 15093, 15684, 16104, 15435, 13831, 12560, 10240, 10240, 10871, 11612,
+     12008, 11591, 11184, 10832, 9245, 8687, 8489, 8339, 8151, 8080, 8080},
+    {31383, 31383, 30988, 29959, 29310, 28628, 27430, 24624, 24099, 23650, 23191, 22055, 20480,
+     20480, 20480, 17000, 15093, 15018, 15691, 14818, 13831, 12560, 10240, 10240, 10240, 11028,
+     11595, 11242, 10839, 10286, 8961, 8502, 8357, 8219, 7999, 7915, 7915},
+    {30037, 30037, 29655, 28672, 28062, 27430, 26214, 23762, 23098, 22474, 21845, 20960, 20480,
+     20480, 20480, 17000, 15093, 14430, 15018, 14273, 13831, 12560, 10240, 10240, 10240, 10480,
+     10923, 10595, 10271, 9926, 8683, 8353, 8182, 8016, 7750, 7646, 7646},
+    {26268, 26268, 26023, 25400, 25018, 24624, 23762, 21174, 20111, 19103, 18076, 18976, 20480,
+     20480, 20480, 17000, 15093, 13930, 13134, 13732, 13831, 12560, 10240, 10240, 10240, 9488,
+     9038, 8877, 8718, 8551, 7982, 7843, 7615, 7394, 7033, 6892, 6892},
+    {24964, 24964, 24796, 24354, 24056, 23650, 22474, 19103, 18365, 17801, 16772, 17263, 18380,
+     19737, 20480, 17000, 14826, 13031, 12482, 12761, 13303, 12560, 10240, 9868, 9190, 8632,
+     8386, 8298, 8214, 8085, 7389, 7116, 7023, 6977, 6766, 6631, 6631},
+    {24785, 24785, 24631, 24214, 23897, 23461, 22216, 18683, 17932, 17377, 16593, 16906, 17646,
+     18690, 20480, 17000, 14573, 12833, 12392, 12546, 12801, 12560, 10240, 9345, 8823, 8453,
+     8297, 8222, 8129, 7990, 7270, 6998, 6901, 6835, 6726, 6595, 6595},
+    {24664, 24664, 24522, 24112, 23769, 23315, 22016, 18356, 17597, 17050, 16472, 16625, 17000,
+     17603, 19503, 16698, 14332, 12674, 12332, 12375, 12325, 12082, 9751, 8802, 8500, 8313,
+     8236, 8164, 8063, 7916, 7178, 6907, 6812, 6739, 6659, 6571, 6571},
+    {24576, 24576, 24445, 24017, 23662, 23191, 21845, 18076, 17311, 16772, 16384, 16384, 16384,
+     16384, 16384, 14064, 12793, 12351, 12288, 12225, 11783, 10512, 8192, 8192, 8192, 8192,
+     8192, 8114, 8006, 7853, 7100, 6830, 6736, 6665, 6580, 6554, 6554},
+    {24576, 24576, 24261, 23446, 22937, 22407, 21379, 18617, 17837, 17111, 16384, 16384, 16384,
+     16384, 16384, 14064, 12793, 12351, 12288, 12225, 11783, 10512, 8192, 8192, 8192, 8192,
+     8192, 8046, 7901, 7745, 7193, 6987, 6881, 6779, 6617, 6554, 6554},
+    {24576, 24576, 22937, 20480, 20480, 20480, 20480, 20480, 20480, 19484, 16384, 16384, 16384,
+     16384, 16384, 14064, 12793, 12529, 12288, 12047, 11783, 10512, 8192, 8192, 8192, 8192,
+     8192, 7572, 7373, 7373, 7373, 7373, 7373, 7373, 6881, 6554, 6554},
+    {22559, 22559, 19846, 18967, 18967, 18967, 18967, 18967, 18967, 18499, 15376, 15376, 15376,
+     15376, 14336, 12016, 11942, 11615, 11280, 10851, 10432, 8997, 7373, 7789, 7789, 7789,
+     7789, 7004, 6969, 6969, 6969, 6969, 6969, 6969, 6554, 6150, 6150},
+    {19333, 19333, 18121, 16548, 16548, 16548, 16548, 16548, 16548, 16571, 13762, 13762, 13762,
+     13886, 14336, 12016, 10379, 10012, 9666, 9497, 9317, 8997, 7373, 7193, 7143, 7143,
+     7143, 6526, 6324, 6324, 6324, 6324, 6324, 6324, 5958, 5505, 5505},
+    {16866, 16866, 16599, 16011, 15666, 15322, 14697, 14289, 13932, 13578, 12529, 12529, 12766,
+     13195, 14336, 12016, 9989, 8601, 8433, 8403, 8710, 8997, 7373, 6916, 6745, 6650,
+     6650, 6438, 6246, 6052, 5831, 5643, 5540, 5436, 5260, 5012, 5012},
+    {16384, 16384, 16318, 16104, 15927, 15691, 15018, 13134, 12751, 12482, 12288, 12288, 12288,
+     12288, 12288, 9968, 8697, 8255, 8192, 8167, 7990, 7481, 6554, 6554, 6554, 6553,
+     6554, 6476, 6368, 6215, 5461, 5192, 5098, 5027, 4941, 4915, 4915},
+    {16143, 16143, 15521, 15080, 14821, 14563, 14095, 13541, 13057, 12576, 12047, 12047, 11809,
+     11381, 10240, 8616, 8301, 8157, 8096, 8028, 7473, 6662, 5734, 6191, 6362, 6457,
+     6457, 6118, 5966, 5813, 5638, 5401, 5270, 5139, 4915, 4819, 4819},
+    {14909, 14909, 13777, 12861, 12861, 12861, 12861, 12861, 12861, 12357, 10813, 10813, 10813,
+     10689, 10240, 8616, 8004, 7797, 7602, 7464, 7317, 6662, 5734, 5914, 5964, 5964,
+     5964, 5177, 5144, 5144, 5144, 5144, 5144, 5144, 4667, 4325, 4325},
+    {13296, 13296, 12288, 11248, 11248, 11248, 11248, 11248, 11248, 11161, 9200, 9200, 9200,
+     9200, 10240, 8616, 7669, 7317, 6957, 6823, 6692, 6662, 5734, 5318, 5318, 5318,
+     5318, 4601, 4499, 4499, 4499, 4499, 4499, 4499, 4358, 3680, 3680},
+    {12288, 12288, 11469, 10240, 10240, 10240, 10240, 10240, 10240, 9742, 8192, 8192, 8192,
+     8192, 8192, 7264, 6755, 6650, 6554, 6457, 6352, 5843, 4915, 4915, 4915, 4915,
+     4915, 4295, 4096, 4096, 4096, 4096, 4096, 4096, 3604, 3277, 3277},
+    {12288, 12288, 12130, 11723, 11469, 11204, 10689, 9309, 8919, 8556, 8192, 8192, 8192,
+     8192, 8192, 7264, 6755, 6579, 6554, 6528, 6352, 5843, 4915, 4915, 4915, 4915,
+     4915, 4770, 4624, 4468, 3916, 3710, 3604, 3503, 3340, 3277, 3277},
+    {12288, 12288, 12222, 12008, 11831, 11595, 10923, 9038, 8656, 8386, 8192, 8192, 8192,
+     8192, 8192, 7264, 6755, 6579, 6554, 6528, 6352, 5843, 4915, 4915, 4915, 4915,
+     4915, 4838, 4730, 4577, 3823, 3554, 3460, 3389, 3303, 3277, 3277},
+    {12244, 12244, 12114, 11913, 11735, 11500, 10834, 8994, 8623, 8362, 8174, 8144, 8069,
+     7948, 7568, 6636, 6539, 6519, 6536, 6423, 5896, 5126, 4291, 4671, 4792, 4867,
+     4897, 4792, 4683, 4532, 3799, 3538, 3447, 3378, 3296, 3268, 3268},
+    {12183, 12183, 12011, 11783, 11622, 11388, 10730, 8943, 8585, 8334, 8150, 8087, 7939,
+     7731, 7373, 6445, 6348, 6450, 6512, 6358, 5781, 5024, 4096, 4454, 4663, 4811,
+     4873, 4737, 4628, 4479, 3771, 3520, 3432, 3368, 3286, 3256, 3256},
+    {12094, 12094, 11917, 11591, 11464, 11242, 10595, 8877, 8537, 8298, 8114, 8016, 7793,
+     7521, 7373, 6445, 6148, 6364, 6476, 6278, 5660, 5024, 4096, 4245, 4516, 4739,
+     4838, 4667, 4557, 4411, 3735, 3496, 3414, 3356, 3270, 3238, 3238},
+    {11442, 11442, 11270, 10832, 10563, 10286, 9926, 8551, 8312, 8085, 7853, 7673, 7373,
+     7373, 7373, 6445, 5936, 5976, 6215, 5912, 5532, 5024, 4096, 4096, 4096, 4397,
+     4577, 4411, 4248, 4077, 3554, 3388, 3321, 3256, 3149, 3108, 3108},
+    {9557, 9557, 9470, 9245, 9106, 8961, 8683, 7982, 7676, 7389, 7100, 7277, 7373,
+     7373, 7373, 6445, 5936, 5760, 5461, 5709, 5532, 5024, 4096, 4096, 4096, 4000,
+     3823, 3735, 3648, 3554, 3277, 3103, 3013, 2926, 2785, 2731, 2731},
+    {8884, 8884, 8829, 8687, 8597, 8502, 8353, 7843, 7432, 7116, 6830, 7058, 7373,
+     7373, 7373, 6445, 5936, 5542, 5192, 5477, 5532, 5024, 4096, 4096, 4096, 3781,
+     3554, 3496, 3443, 3388, 3103, 2975, 2881, 2792, 2650, 2596, 2596},
+    {8471, 8471, 8435, 8339, 8288, 8219, 8016, 7394, 7242, 6977, 6665, 6824, 7120,
+     7373, 7373, 6445, 5936, 5295, 5027, 5215, 5532, 5024, 4096, 4096, 3844, 3547,
+     3389, 3356, 3315, 3256, 2926, 2792, 2742, 2703, 2566, 2513, 2513},
+    {8343, 8343, 8312, 8234, 8175, 8096, 7868, 7194, 7041, 6921, 6614, 6717, 6929,
+     7193, 7373, 6445, 5790, 5177, 4976, 5090, 5290, 5024, 4096, 3916, 3652, 3441,
+     3337, 3307, 3263, 3197, 2848, 2713, 2664, 2626, 2539, 2488, 2488},
+    {8257, 8257, 8230, 8151, 8086, 7999, 7750, 7033, 6880, 6766, 6580, 6631, 6745,
+     6916, 7373, 6445, 5634, 5079, 4941, 4985, 5032, 5024, 4096, 3640, 3468, 3354,
+     3303, 3270, 3221, 3149, 2785, 2650, 2602, 2566, 2521, 2471, 2471},
+    {8208, 8208, 8182, 8098, 8029, 7937, 7672, 6928, 6775, 6666, 6560, 6573, 6606,
+     6662, 6881, 6011, 5340, 5013, 4922, 4915, 4814, 4542, 3604, 3386, 3329, 3297,
+     3283, 3246, 3193, 3118, 2745, 2610, 2563, 2527, 2484, 2461, 2461},
+    {8192, 8192, 8166, 8080, 8009, 7915, 7646, 6892, 6739, 6631, 6554, 6553, 6554,
+     6554, 6554, 5626, 5117, 4940, 4915, 4890, 4713, 4205, 3277, 3277, 3277, 3277,
+     3277, 3238, 3184, 3108, 2731, 2596, 2549, 2513, 2471, 2458, 2458},
+    {8192, 8192, 8166, 8080, 8009, 7915, 7646, 6892, 6739, 6631, 6554, 6553, 6554,
+     6554, 6554, 5626, 5117, 4940, 4915, 4890, 4713, 4205, 3277, 3277, 3277, 3277,
+     3277, 3238, 3184, 3108, 2731, 2596, 2549, 2513, 2471, 2458, 2458}
+};
+
+static const uint16_t fuzzy_surface_ki_hot_air[FUZZY_SURFACE_E_POINTS][FUZZY_SURFACE_DE_POINTS] = {
+    {32768, 32768, 32637, 32209, 31854, 31383, 30037, 26268, 25503, 24964, 24576, 24576, 24576,
+     24576, 24576, 19936, 17394, 16510, 16384, 16258, 15374, 12832, 8192, 8192, 8192, 8192,
+     8192, 7998, 7728, 7346, 5461, 4788, 4553, 4375, 4161, 4096, 4096},
+    {32768, 32768, 32637, 32209, 31854, 31383, 30037, 26268, 25503, 24964, 24576, 24576, 24576,
+     24576, 24576, 19936, 17394, 16510, 16384, 16258, 15374, 12832, 8192, 8192, 8192, 8192,
+     8192, 7998, 7728, 7346, 5461, 4788, 4553, 4375, 4161, 4096, 4096},
+    {32735, 32735, 32540, 32109, 31753, 31281, 29938, 26205, 25451, 24920, 24543, 24476, 24313,
+     24032, 22937, 18700, 17092, 16445, 16368, 16054, 14786, 12079, 7864, 8083, 8139, 8172,
+     8185, 7968, 7699, 7319, 5456, 4789, 4556, 4380, 4167, 4093, 4093},
+    {32637, 32637, 32260, 31822, 31462, 30988, 29655, 26023, 25301, 24796, 24445, 24190, 23619,
+     22762, 20480, 17000, 16467, 16267, 16318, 15892, 14060, 11316, 7373, 7829, 8001, 8115,
+     8166, 7883, 7615, 7243, 5439, 4793, 4565, 4393, 4185, 4083, 4083},
+    {32465, 32465, 32083, 31373, 31008, 30533, 29218, 25746, 25069, 24603, 24273, 23756, 22697,
+     21379, 20480, 17000, 15759, 16001, 16232, 15652, 13760, 11316, 7373, 7553, 7816, 8028,
+     8131, 7750, 7485, 7126, 5414, 4798, 4580, 4414, 4171, 4066, 4066},
+    {32209, 32209, 31822, 30800, 30433, 29959, 28672, 25400, 24781, 24354, 24017, 23224, 21742,
+     20480, 20480, 17000, 15093, 15684, 16104, 15365, 13477, 11316, 7373, 7373, 7625, 7922,
+     8080, 7699, 7324, 6981, 5383, 4805, 4598, 4440, 4150, 4040, 4040},
+    {31383, 31383, 30988, 29959, 29310, 28628, 27430, 24624, 24099, 23650, 23191, 22055, 20480,
+     20480, 20480, 17000, 15093, 15018, 15691, 14761, 13477, 11316, 7373, 7373, 7373, 7688,
+     7915, 7560, 7171, 6655, 5312, 4820, 4607, 4404, 4081, 3957, 3957},
+    {30037, 30037, 29655, 28672, 28062, 27430, 26214, 23762, 23098, 22474, 21845, 20960, 20480,
+     20480, 20480, 17000, 15093, 14430, 15018, 14229, 13477, 11316, 7373, 7373, 7373, 7469,
+     7646, 7281, 6919, 6534, 5243, 4791, 4556, 4330, 3965, 3823, 3823},
+    {26268, 26268, 26023, 25400, 25018, 24624, 23762, 21174, 20111, 19103, 18076, 18976, 20480,
+     20480, 20480, 17000, 15093, 13930, 13134, 13677, 13477, 11316, 7373, 7373, 7373, 7072,
+     6892, 6581, 6276, 5955, 4867, 4561, 4294, 4035, 3612, 3446, 3446},
+    {24964, 24964, 24796, 24354, 24056, 23650, 22474, 19103, 18365, 17801, 16772, 17263, 18380,
+     19737, 20480, 17000, 14826, 13031, 12482, 12685, 12876, 11316, 7373, 7224, 6953, 6729,
+     6631, 6376, 6179, 5903, 4533, 4025, 3850, 3745, 3467, 3316, 3316},
+    {24785, 24785, 24631, 24214, 23897, 23461, 22216, 18683, 17932, 17377, 16593, 16906, 17646,
+     18690, 20480, 17000, 14573, 12833, 12392, 12466, 12305, 11316, 7373, 7015, 6806, 6658,
+     6595, 6385, 6180, 5892, 4465, 3944, 3760, 3631, 3443, 3298, 3298},
+    {24664, 24664, 24522, 24112, 23769, 23315, 22016, 18356, 17597, 17050, 16472, 16625, 17000,
+     17603, 19503, 16698, 14332, 12674, 12332, 12291, 11763, 10822, 7177, 6797, 6677, 6602,
+     6571, 6392, 6182, 5884, 4413, 3883, 3696, 3555, 3393, 3286, 3286},
+    {24576, 24576, 24445, 24017, 23662, 23191, 21845, 18076, 17311, 16772, 16384, 16384, 16384,
+     16384, 16384, 14064, 12793, 12351, 12288, 12200, 11581, 9801, 6554, 6554, 6554, 6554,
+     6554, 6398, 6183, 5877, 4369, 3831, 3642, 3500, 3329, 3277, 3277},
+    {24576, 24576, 24261, 23446, 22937, 22407, 21379, 18617, 17837, 17111, 16384, 16384, 16384,
+     16384, 16384, 14064, 12793, 12351, 12288, 12200, 11581, 9801, 6554, 6554, 6554, 6554,
+     6554, 6263, 5972, 5660, 4555, 4144, 3932, 3729, 3403, 3277, 3277},
+    {24576, 24576, 22937, 20480, 20480, 20480, 20480, 20480, 20480, 19484, 16384, 16384, 16384,
+     16384, 16384, 14064, 12793, 12529, 12288, 11950, 11581, 9801, 6554, 6554, 6554, 6554,
+     6554, 5313, 4915, 4915, 4915, 4915, 4915, 4915, 3932, 3277, 3277},
+    {22559, 22559, 19846, 18967, 18967, 18967, 18967, 18967, 18967, 18499, 15376, 15376, 15376,
+     15376, 14336, 12016, 11942, 11615, 11280, 10672, 10077, 8286, 5734, 6150, 6150, 6150,
+     6150, 4724, 4613, 4613, 4613, 4613, 4613, 4613, 3952, 3075, 3075},
+    {19333, 19333, 18121, 16548, 16548, 16548, 16548, 16548, 16548, 16571, 13762, 13762, 13762,
+     13886, 14336, 12016, 10379, 10012, 9666, 9375, 9067, 8286, 5734, 5554, 5505, 5505,
+     5505, 4368, 4129, 4129, 4129, 4129, 4129, 4129, 3475, 2752, 2752},
+    {16866, 16866, 16599, 16011, 15666, 15322, 14697, 14289, 13932, 13578, 12529, 12529, 12766,
+     13195, 14336, 12016, 9989, 8601, 8433, 8356, 8409, 8286, 5734, 5278, 5106, 5012,
+     5012, 4622, 4349, 4074, 3759, 3459, 3294, 3128, 2846, 2506, 2506},
+    {16384, 16384, 16318, 16104, 15927, 15691, 15018, 13134, 12751, 12482, 12288, 12288, 12288,
+     12288, 12288, 9968, 8697, 8255, 8192, 8141, 7788, 6771, 4915, 4915, 4915, 4915,
+     4915, 4799, 4637, 4407, 3277, 2873, 2732, 2625, 2497, 2458, 2458},
+    {16143, 16143, 15521, 15080, 14821, 14563, 14095, 13541, 13057, 12576, 12047, 12047, 11809,
+     11381, 10240, 8616, 8301, 8157, 8096, 7993, 7247, 6129, 4506, 4734, 4819, 4867,
+     4867, 4422, 4173, 3924, 3638, 3307, 3125, 2942, 2630, 2409, 2409},
+    {14909, 14909, 13777, 12861, 12861, 12861, 12861, 12861, 12861, 12357, 10813, 10813, 10813,
+     10689, 10240, 8616, 8004, 7797, 7602, 7373, 7130, 6129, 4506, 4595, 4620, 4620,
+     4620, 3525, 3391, 3391, 3391, 3391, 3391, 3391, 2731, 2163, 2163},
+    {13296, 13296, 12288, 11248, 11248, 11248, 11248, 11248, 11248, 11161, 9200, 9200, 9200,
+     9200, 10240, 8616, 7669, 7317, 6957, 6688, 6425, 6129, 4506, 4298, 4298, 4298,
+     4298, 3188, 3069, 3069, 3069, 3069, 3069, 3069, 2719, 1840, 1840},
+    {12288, 12288, 11469, 10240, 10240, 10240, 10240, 10240, 10240, 9742, 8192, 8192, 8192,
+     8192, 8192, 7264, 6755, 6650, 6554, 6409, 6251, 5488, 4096, 4096, 4096, 4096,
+     4096, 3166, 2867, 2867, 2867, 2867, 2867, 2867, 2130, 1638, 1638},
+    {12288, 12288, 12130, 11723, 11469, 11204, 10689, 9309, 8919, 8556, 8192, 8192, 8192,
+     8192, 8192, 7264, 6755, 6579, 6554, 6516, 6251, 5488, 4096, 4096, 4096, 4096,
+     4096, 3878, 3660, 3426, 2597, 2289, 2130, 1977, 1733, 1638, 1638},
+    {12288, 12288, 12222, 12008, 11831, 11595, 10922, 9038, 8656, 8386, 8192, 8192, 8192,
+     8192, 8192, 7264, 6755, 6579, 6554, 6516, 6251, 5488, 4096, 4096, 4096, 4096,
+     4096, 3980, 3818, 3588, 2458, 2054, 1913, 1806, 1678, 1638, 1638},
+    {12244, 12244, 12114, 11913, 11735, 11500, 10834, 8994, 8623, 8362, 8174, 8144, 8069,
+     7948, 7568, 6636, 6539, 6519, 6536, 6411, 5816, 4916, 3784, 3974, 4034, 4072,
+     4087, 3934, 3773, 3548, 2447, 2054, 1915, 1811, 1689, 1630, 1630},
+    {12183, 12183, 12011, 11783, 11622, 11388, 10730, 8943, 8585, 8334, 8150, 8087, 7939,
+     7731, 7373, 6445, 6348, 6450, 6512, 6347, 5710, 4846, 3686, 3865, 3970, 4044,
+     4075, 3881, 3721, 3500, 2435, 2053, 1919, 1823, 1691, 1617, 1617},
+    {12094, 12094, 11917, 11591, 11464, 11242, 10595, 8877, 8537, 8298, 8114, 8016, 7793,
+     7521, 7373, 6445, 6148, 6364, 6476, 6267, 5599, 4846, 3686, 3761, 3896, 4008,
+     4057, 3812, 3654, 3439, 2420, 2053, 1927, 1843, 1678, 1600, 1600},
+    {11442, 11442, 11270, 10832, 10563, 10286, 9926, 8551, 8312, 8085, 7853, 7673, 7373,
+     7373, 7373, 6445, 5936, 5976, 6215, 5905, 5482, 4846, 3686, 3686, 3686, 3837,
+     3927, 3665, 3409, 3138, 2343, 2099, 1948, 1801, 1563, 1469, 1469},
+    {9557, 9557, 9470, 9245, 9106, 8961, 8683, 7982, 7676, 7389, 7100, 7277, 7373,
+     7373, 7373, 6445, 5936, 5760, 5461, 5703, 5482, 4846, 3686, 3686, 3686, 3638,
+     3550, 3336, 3124, 2898, 2130, 1800, 1628, 1463, 1196, 1092, 1092},
+    {8884, 8884, 8829, 8687, 8597, 8502, 8353, 7843, 7432, 7116, 6830, 7058, 7373,
+     7373, 7373, 6445, 5936, 5542, 5192, 5469, 5482, 4846, 3686, 3686, 3686, 3529,
+     3415, 3232, 3040, 2797, 1973, 1647, 1476, 1314, 1056, 958, 958},
+    {8471, 8471, 8435, 8339, 8288, 8219, 8016, 7394, 7242, 6977, 6665, 6824, 7120,
+     7373, 7373, 6445, 5936, 5295, 5027, 5205, 5482, 4846, 3686, 3686, 3560, 3412,
+     3333, 3161, 2980, 2784, 1814, 1448, 1315, 1213, 968, 875, 875},
+    {8343, 8343, 8312, 8234, 8175, 8096, 7868, 7194, 7041, 6921, 6614, 6717, 6929,
+     7193, 7373, 6445, 5790, 5177, 4976, 5079, 5228, 4846, 3686, 3596, 3465, 3359,
+     3307, 3137, 2987, 2778, 1744, 1362, 1225, 1121, 940, 849, 849},
+    {8257, 8257, 8230, 8151, 8086, 7999, 7750, 7033, 6880, 6766, 6580, 6631, 6745,
+     6916, 7373, 6445, 5634, 5079, 4941, 4974, 4957, 4846, 3686, 3458, 3372, 3315,
+     3290, 3149, 2993, 2773, 1688, 1294, 1154, 1049, 921, 832, 832},
+    {8208, 8208, 8182, 8098, 8029, 7937, 7672, 6928, 6775, 6666, 6560, 6573, 6606,
+     6662, 6881, 6011, 5340, 5013, 4922, 4903, 4774, 4452, 3441, 3331, 3303, 3287,
+     3280, 3158, 2997, 2770, 1651, 1250, 1109, 1003, 874, 822, 822},
+    {8192, 8192, 8166, 8080, 8009, 7915, 7646, 6892, 6739, 6631, 6554, 6554, 6554,
+     6554, 6554, 5626, 5117, 4940, 4915, 4890, 4713, 4205, 3277, 3277, 3277, 3277,
+     3277, 3160, 2999, 2769, 1638, 1235, 1093, 987, 858, 819, 819},
+    {8192, 8192, 8166, 8080, 8009, 7915, 7646, 6892, 6739, 6631, 6554, 6554, 6554,
+     6554, 6554, 5626, 5117, 4940, 4915, 4890, 4713, 4205, 3277, 3277, 3277, 3277,
+     3277, 3160, 2999, 2769, 1638, 1235, 1093, 987, 858, 819, 819}
+};
+
+static const uint16_t fuzzy_surface_kd_hot_air[FUZZY_SURFACE_E_POINTS][FUZZY_SURFACE_DE_POINTS] = {
+    {3277, 3277, 3329, 3500, 3642, 3831, 4369, 5877, 6183, 6398, 6554, 6553, 6554,
+     6554, 6554, 8409, 9426, 9780, 9830, 9881, 10234, 11251, 13107, 13107, 13107, 13107,
+     13107, 13262, 13478, 13784, 15292, 15830, 16018, 16160, 16331, 16384, 16384},
+    {3277, 3277, 3329, 3500, 3642, 3831, 4369, 5877, 6183, 6398, 6554, 6553, 6554,
+     6554, 6554, 8409, 9426, 9780, 9830, 9881, 10234, 11251, 13107, 13107, 13107, 13107,
+     13107, 13262, 13478, 13784, 15292, 15830, 16018, 16160, 16331, 16384, 16384},
+    {3290, 3290, 3368, 3540, 3683, 3871, 4408, 5902, 6203, 6416, 6566, 6593, 6658,
+     6771, 7209, 9085, 9628, 9830, 9843, 10026, 10680, 12022, 13762, 13325, 13212, 13147,
+     13120, 13308, 13525, 13830, 15320, 15850, 16036, 16176, 16345, 16397, 16397},
+    {3329, 3329, 3480, 3655, 3799, 3988, 4522, 5974, 6264, 6465, 6606, 6708, 6936,
+     7279, 8192, 10048, 10064, 9971, 9883, 10158, 11268, 12890, 14745, 13833, 13490, 13261,
+     13159, 13440, 13661, 13963, 15401, 15909, 16087, 16222, 16384, 16436, 16436},
+    {3398, 3398, 3550, 3835, 3981, 4170, 4697, 6086, 6356, 6543, 6675, 6881, 7305,
+     7832, 8192, 10048, 10580, 10180, 9951, 10355, 11580, 12890, 14745, 14386, 13858, 13435,
+     13228, 13645, 13870, 14166, 15526, 16001, 16167, 16293, 16449, 16505, 16505},
+    {3500, 3500, 3655, 4064, 4211, 4400, 4915, 6224, 6471, 6642, 6777, 7094, 7687,
+     8192, 8192, 10048, 11065, 10430, 10054, 10589, 11873, 12890, 14745, 14745, 14241, 13647,
+     13331, 13747, 14131, 14419, 15682, 16116, 16269, 16384, 16546, 16607, 16607},
+    {3831, 3831, 3988, 4400, 4660, 4932, 5412, 6534, 6744, 6924, 7107, 7562, 8192,
+     8192, 8192, 10048, 11065, 10955, 10384, 11083, 11873, 12890, 14745, 14745, 14745, 14115,
+     13661, 14026, 14437, 14988, 16036, 16384, 16521, 16651, 16858, 16938, 16938},
+    {4369, 4369, 4522, 4915, 5159, 5412, 5898, 6879, 7145, 7394, 7646, 8000, 8192,
+     8192, 8192, 10048, 11065, 11418, 10923, 11519, 11873, 12890, 14745, 14745, 14745, 14553,
+     14199, 14551, 14901, 15273, 16384, 16731, 16912, 17086, 17367, 17476, 17476},
+    {5877, 5877, 5974, 6224, 6377, 6534, 6879, 7914, 8339, 8742, 9153, 8793, 8192,
+     8192, 8192, 10048, 11065, 11825, 12430, 11952, 11873, 12890, 14745, 14745, 14745, 15347,
+     15707, 15931, 16152, 16384, 17495, 17780, 18068, 18348, 18805, 18984, 18984},
+    {6398, 6398, 6465, 6642, 6761, 6924, 7394, 8742, 9038, 9263, 9675, 9478, 9032,
+     8489, 8192, 10048, 11320, 12556, 12952, 12729, 12295, 12890, 14745, 15043, 15585, 16032,
+     16229, 16384, 16568, 16836, 18216, 18741, 18922, 19020, 19327, 19505, 19505},
+    {6470, 6470, 6531, 6698, 6825, 6999, 7497, 8911, 9211, 9433, 9747, 9621, 9325,
+     8908, 8192, 10048, 11562, 12717, 13023, 12900, 12696, 12890, 14745, 15461, 15879, 16175,
+     16300, 16448, 16645, 16928, 18361, 18892, 19082, 19211, 19404, 19577, 19577},
+    {6518, 6518, 6575, 6739, 6876, 7058, 7578, 9042, 9345, 9564, 9795, 9734, 9584,
+     9342, 8583, 10252, 11793, 12846, 13072, 13037, 13077, 13272, 15136, 15896, 16137, 16287,
+     16348, 16497, 16704, 17000, 18473, 19008, 19197, 19341, 19501, 19625, 19625},
+    {6554, 6554, 6606, 6777, 6919, 7107, 7646, 9153, 9459, 9675, 9830, 9830, 9830,
+     9830, 9830, 11686, 12703, 13057, 13107, 13157, 13511, 14528, 16384, 16384, 16384, 16384,
+     16384, 16539, 16755, 17061, 18568, 19107, 19295, 19437, 19608, 19661, 19661},
+    {6554, 6554, 6680, 7005, 7209, 7421, 7832, 8937, 9249, 9539, 9830, 9830, 9830,
+     9830, 9830, 11686, 12703, 13057, 13107, 13157, 13511, 14528, 16384, 16384, 16384, 16384,
+     16384, 16675, 16965, 17277, 18382, 18793, 19005, 19209, 19534, 19661, 19661},
+    {6554, 6554, 7209, 8192, 8192, 8192, 8192, 8192, 8192, 8590, 9830, 9830, 9830,
+     9830, 9830, 11686, 12703, 12914, 13107, 13300, 13511, 14528, 16384, 16384, 16384, 16384,
+     16384, 17624, 18022, 18022, 18022, 18022, 18022, 18022, 19005, 19661, 19661},
+    {7360, 7360, 8715, 8998, 8998, 8998, 8998, 8998, 8998, 9203, 10637, 10637, 10637,
+     10637, 11469, 13324, 13383, 13646, 13914, 14364, 14805, 16166, 18022, 17190, 17190, 17190,
+     17190, 18759, 18829, 18829, 18829, 18829, 18829, 18829, 19661, 20467, 20467},
+    {8651, 8651, 9334, 10289, 10289, 10289, 10289, 10289, 10289, 10355, 11927, 11927, 11927,
+     11828, 11469, 13324, 14634, 14927, 15204, 15413, 15634, 16166, 18022, 18382, 18481, 18481,
+     18481, 19716, 20119, 20119, 20119, 20119, 20119, 20119, 20852, 21758, 21758},
+    {9638, 9638, 9830, 10277, 10540, 10801, 11276, 11626, 11931, 12235, 12914, 12914, 12724,
+     12381, 11469, 13324, 14946, 16056, 16191, 16243, 16150, 16166, 18022, 18935, 19278, 19468,
+     19468, 19891, 20276, 20663, 21106, 21481, 21687, 21895, 22247, 22745, 22745},
+    {9830, 9830, 9883, 10054, 10196, 10384, 10923, 12430, 12736, 12952, 13107, 13107, 13107,
+     13107, 13107, 14963, 15980, 16333, 16384, 16434, 16788, 17805, 19661, 19661, 19661, 19661,
+     19661, 19816, 20031, 20337, 21845, 22383, 22572, 22714, 22885, 22937, 22937},
+    {10023, 10023, 10520, 10873, 11080, 11287, 11661, 12105, 12492, 12877, 13300, 13300, 13490,
+     13833, 14745, 16601, 16618, 16524, 16577, 16711, 17822, 19443, 21299, 20386, 20043, 19853,
+     19853, 20532, 20836, 21142, 21492, 21966, 22228, 22490, 22937, 23130, 23130},
+    {11010, 11010, 11915, 12648, 12648, 12648, 12648, 12648, 12648, 13051, 14287, 14287, 14287,
+     14386, 14745, 16601, 17134, 17355, 17563, 17840, 18133, 19443, 21299, 20939, 20840, 20840,
+     20840, 22413, 22479, 22479, 22479, 22479, 22479, 22479, 23434, 24117, 24117},
+    {12300, 12300, 13107, 13939, 13939, 13939, 13939, 13939, 13939, 14008, 15577, 15577, 15577,
+     15577, 14745, 16601, 17963, 18404, 18854, 19122, 19384, 19443, 21299, 22131, 22131, 22131,
+     22131, 23565, 23769, 23769, 23769, 23769, 23769, 23769, 24052, 25407, 25407},
+    {13107, 13107, 13762, 14745, 14745, 14745, 14745, 14745, 14745, 15144, 16384, 16384, 16384,
+     16384, 16384, 18240, 19257, 19468, 19661, 19853, 20064, 21081, 22937, 22937, 22937, 22937,
+     22937, 24177, 24576, 24576, 24576, 24576, 24576, 24576, 25559, 26214, 26214},
+    {13107, 13107, 13233, 13559, 13762, 13974, 14386, 15490, 15802, 16093, 16384, 16384, 16384,
+     16384, 16384, 18240, 19257, 19610, 19661, 19711, 20064, 21081, 22937, 22937, 22937, 22937,
+     22937, 23228, 23519, 23831, 24935, 25347, 25559, 25762, 26088, 26214, 26214},
+    {13107, 13107, 13159, 13331, 13473, 13661, 14199, 15707, 16013, 16229, 16384, 16384, 16384,
+     16384, 16384, 18240, 19257, 19610, 19661, 19711, 20064, 21081, 22937, 22937, 22937, 22937,
+     22937, 23092, 23308, 23614, 25122, 25660, 25848, 25990, 26162, 26214, 26214},
+    {13142, 13142, 13266, 13427, 13570, 13759, 14295, 15768, 16063, 16270, 16419, 16480, 16630,
+     16872, 17631, 19496, 19690, 19730, 19696, 19922, 20975, 22516, 24185, 23425, 23184, 23034,
+     22973, 23242, 23464, 23769, 25231, 25747, 25927, 26062, 26227, 26285, 26285},
+    {13191, 13191, 13363, 13556, 13686, 13875, 14407, 15839, 16123, 16320, 16467, 16593, 16889,
+     17306, 18022, 19878, 20071, 19867, 19744, 20051, 21205, 22720, 24576, 23860, 23442, 23146,
+     23021, 23418, 23646, 23951, 25359, 25849, 26019, 26145, 26317, 26381, 26381},
+    {13262, 13262, 13440, 13747, 13846, 14026, 14551, 15931, 16199, 16384, 16539, 16736, 17182,
+     17725, 18022, 19878, 20472, 20039, 19816, 20212, 21447, 22720, 24576, 24278, 23736, 23289,
+     23092, 23646, 23882, 24184, 25524, 25981, 26139, 26263, 26451, 26524, 26524},
+    {13784, 13784, 13963, 14419, 14699, 14988, 15273, 16384, 16616, 16836, 17061, 17421, 18022,
+     18022, 18022, 19878, 20895, 20816, 20337, 20943, 21703, 22720, 24576, 24576, 24576, 23974,
+     23614, 24184, 24743, 25332, 26349, 26718, 26921, 27119, 27441, 27568, 27568},
+    {15292, 15292, 15401, 15682, 15856, 16036, 16384, 17495, 17867, 18216, 18568, 18214, 18022,
+     18022, 18022, 19878, 20895, 21248, 21845, 21349, 21703, 22720, 24576, 24576, 24576, 24768,
+     25122, 25524, 25923, 26349, 28180, 28945, 29342, 29725, 30343, 30583, 30583},
+    {15830, 15830, 15909, 16116, 16247, 16384, 16731, 17780, 18331, 18741, 19107, 18652, 18022,
+     18022, 18022, 19878, 20895, 21684, 22383, 21813, 21703, 22720, 24576, 24576, 24576, 25206,
+     25660, 25981, 26308, 26718, 28945, 29870, 30313, 30734, 31403, 31660, 31660},
+    {16160, 16160, 16222, 16384, 16499, 16651, 17086, 18348, 18636, 19020, 19437, 19120, 18527,
+     18022, 18022, 19878, 20895, 22178, 22714, 22338, 21703, 22720, 24576, 24576, 25080, 25674,
+     25990, 26263, 26614, 27119, 29725, 30734, 31104, 31390, 32065, 32320, 32320},
+    {16263, 16263, 16319, 16475, 16600, 16767, 17242, 18601, 18897, 19122, 19539, 19333, 18909,
+     18382, 18022, 19878, 21188, 22413, 22816, 22588, 22187, 22720, 24576, 24935, 25463, 25886,
+     26093, 26368, 26750, 27298, 30068, 31108, 31482, 31768, 32272, 32525, 32525},
+    {16331, 16331, 16384, 16546, 16680, 16858, 17367, 18805, 19107, 19327, 19608, 19506, 19278,
+     18935, 18022, 19878, 21499, 22610, 22885, 22797, 22703, 22720, 24576, 25488, 25831, 26060,
+     26162, 26451, 26860, 27441, 30343, 31403, 31779, 32065, 32412, 32663, 32663},
+    {16371, 16371, 16423, 16592, 16732, 16917, 17448, 18937, 19242, 19459, 19648, 19621, 19556,
+     19443, 19005, 20745, 22088, 22742, 22924, 22937, 23140, 23683, 25559, 25996, 26109, 26174,
+     26201, 26506, 26931, 27535, 30521, 31594, 31970, 32255, 32599, 32742, 32742},
+    {16384, 16384, 16436, 16607, 16749, 16938, 17476, 18984, 19290, 19505, 19661, 19661, 19661,
+     19661, 19661, 21516, 22533, 22887, 22937, 22988, 23341, 24358, 26214, 26214, 26214, 26214,
+     26214, 26524, 26956, 27568, 30583, 31660, 32036, 32320, 32663, 32768, 32768},
+    {16384, 16384, 16436, 16607, 16749, 16938, 17476, 18984, 19290, 19505, 19661, 19661, 19661,
+     19661, 19661, 21516, 22533, 22887, 22937, 22988, 23341, 24358, 26214, 26214, 26214, 26214,
+     26214, 26524, 26956, 27568, 30583, 31660, 32036, 32320, 32663, 32768, 32768}
+};
+
+#endif
\ No newline at end of file
@@ -0,0 +1,276 @@
+#!/usr/bin/env python3
+# Generator permukaan gain fuzzy_surface.h (Kp/Ki/Kd atas bidang e, de ternormalisasi).
+#
+#   python3 gen_fuzzy_surface.py            tulis ulang ../fuzzy_surface.h
+#   python3 gen_fuzzy_surface.py --check    bandingkan interpolasi bilinear vs inferensi
+#                                           asli, gagal jika header usang atau deviasi > batas
+#
+# Matriks aturan (FUZZY_KP_T12 dan seterusnya) dibaca dari fuzzy_pid.c; fungsi keanggotaan
+# di bawah harus sama dengan fuzzy_rule_gains() di fuzzy_pid.c. Juga dipasang sebagai
+# extra_scripts "pre:" PlatformIO, jadi header dibuat ulang otomatis jika matriks berubah.
+
+import math
+import os
+import re
+import sys
+
+try:
+    Import("env")  # noqa: F821 (hanya ada di dalam SCons/PlatformIO)
+    HERE = os.path.join(env.subst("$PROJECT_DIR"), "lib", "fuzzy_pid", "tools")  # noqa: F821
+    IN_SCONS = True
+except NameError:
+    HERE = os.path.dirname(os.path.abspath(__file__))
+    IN_SCONS = False
+
+LIB_DIR = os.path.dirname(HERE)
+SOURCE_IN = os.path.join(LIB_DIR, "fuzzy_pid.c")
+HEADER_OUT = os.path.join(LIB_DIR, "fuzzy_surface.h")
+
+MODES = (("t12", "T12"), ("hot_air", "HOT_AIR"))
+GAINS = ("KP", "KI", "KD")
+
+# --- Grid ---
+# Sumbu tidak seragam (simetris, separuh positif): rapat di tepi MF dan di tempat
+# MF kecil saling bersaing (e ~0.43, e ~0.7..0.8, de ~0.04), tempat permukaan
+# berubah tajam. Dipilih dengan pemecahan sel ber-error terbesar secara berulang.
+E_AXIS_POS = [0.0, 0.05, 0.075, 0.0875, 0.1, 0.25, 0.4, 0.425, 0.4375, 0.45,
+              0.5, 0.6, 0.65, 0.7, 0.725, 0.75, 0.775, 0.8, 1.0]
+DE_AXIS_POS = [0.0, 0.025, 0.0375, 0.04375, 0.05, 0.09375, 0.1375, 0.225, 0.4,
+               0.45, 0.475, 0.5, 0.6, 0.65, 0.675, 0.7, 0.75, 0.8, 1.0]
+
+# Titik di tepi +-1 dievaluasi sedikit di dalam: tepat di +-1 semua MF bernilai 0
+# (ditangani terpisah di C), sel terakhir harus mengikuti limit dari dalam
+EDGE_EPS = 1e-6
+
+# Batas deviasi untuk --check, relatif terhadap nilai maksimum matriks gain
+MAX_DEV_FRAC = 0.04
+CHECK_POINTS = 601          # Grid uji per sumbu (digeser agar tidak jatuh di titik grid)
+
+
+def symmetric(pos):
+    return [-v for v in reversed(pos[1:])] + pos
+
+
+E_AXIS = symmetric(E_AXIS_POS)
+DE_AXIS = symmetric(DE_AXIS_POS)
+
+
+def read_matrices():
+    text = open(SOURCE_IN, encoding="utf-8").read()
+    mats = {}
+    for _, mode in MODES:
+        for gain in GAINS:
+            name = "FUZZY_%s_%s" % (gain, mode)
+            m = re.search(r"#define\s+%s\(M\)\s*\{(.*?)\n\}" % name, text, re.S)
+            if not m:
+                sys.exit("gen_fuzzy_surface: %s tidak ditemukan di fuzzy_pid.c" % name)
+            vals = [float(v) for v in re.findall(r"M\(([0-9.eE+-]+)f?\)", m.group(1))]
+            if len(vals) != 25:
+                sys.exit("gen_fuzzy_surface: %s bukan matriks 5x5" % name)
+            mats[(gain, mode)] = [vals[i * 5:i * 5 + 5] for i in range(5)]
+    return mats
+
+
+# --- Inferensi asli (meniru fuzzy_pid.c) ---
+def tri_mf(x, a, b, c):
+    if x <= a or x >= c:
+        return 0.0
+    if x < b:
+        t = (x - a) / (b - a)
+        return t * t
+    t = (c - x) / (c - b)
+    return t * t
+
+
+def trap_mf(x, a, b, c, d):
+    if x <= a or x >= d:
+        return 0.0
+    if x < b:
+        t = (x - a) / (b - a)
+        return 0.5 * (1.0 - math.cos(t * math.pi))
+    if x <= c:
+        return 1.0
+    t = (d - x) / (d - c)
+    return 0.5 * (1.0 - math.cos(t * math.pi))
+
+
+def e_mf(x):
+    return [trap_mf(x, -1.0, -1.0, -0.8, -0.4), tri_mf(x, -0.8, -0.4, 0.0),
+            tri_mf(x, -0.1, 0.0, 0.1), tri_mf(x, 0.0, 0.4, 0.8),
+            trap_mf(x, 0.4, 0.8, 1.0, 1.0)]
+
+
+def de_mf(x):
+    return [trap_mf(x, -1.0, -1.0, -0.8, -0.4), tri_mf(x, -0.8, -0.4, 0.0),
+            tri_mf(x, -0.05, 0.0, 0.05), tri_mf(x, 0.0, 0.4, 0.8),
+            trap_mf(x, 0.4, 0.8, 1.0, 1.0)]
+
+
+# Rata-rata terbobot 25 aturan; None jika semua bobot nol (gain default di C)
+def inference(mats, mode, e_mfs, de_mfs):
+    sums = [0.0, 0.0, 0.0]
+    weight = 0.0
+    for i in range(5):
+        for j in range(5):
+            w = min(e_mfs[i], de_mfs[j])
+            weight += w
+            for k, gain in enumerate(GAINS):
+                sums[k] += w * mats[(gain, mode)][i][j]
+    if weight <= 1e-6:
+        return None
+    return [s / weight for s in sums]
+
+
+def clamp_edge(x):
+    return max(-1.0 + EDGE_EPS, min(1.0 - EDGE_EPS, x))
+
+
+def build_surfaces(mats):
+    e_mfs = [e_mf(clamp_edge(x)) for x in E_AXIS]
+    de_mfs = [de_mf(clamp_edge(x)) for x in DE_AXIS]
+    surf = {}
+    for _, mode in MODES:
+        grid = [[inference(mats, mode, em, dm) for dm in de_mfs] for em in e_mfs]
+        for k, gain in enumerate(GAINS):
+            surf[(gain, mode)] = [[cell[k] for cell in row] for row in grid]
+    return surf
+
+
+# Gain disimpan uint16: nilai = raw * skala, skala = maks / 65535 per gain
+def gain_scale(mats, gain):
+    return max(max(max(row) for row in mats[(gain, mode)]) for _, mode in MODES) / 65535.0
+
+
+def quantize(v, scale):
+    return int(math.floor(v / scale + 0.5))
+
+
+def fmt_axis(name, values, per_line=8):
+    lines = ["static const float %s[%d] = {" % (name, len(values))]
+    for i in range(0, len(values), per_line):
+        chunk = ", ".join("%.6ff" % v for v in values[i:i + per_line])
+        lines.append("    " + chunk + ",")
+    lines[-1] = lines[-1].rstrip(",")
+    lines.append("};")
+    return lines
+
+
+def fmt_surface(name, rows, scale):
+    lines = ["static const uint16_t %s[FUZZY_SURFACE_E_POINTS][FUZZY_SURFACE_DE_POINTS] = {" % name]
+    for r, row in enumerate(rows):
+        q = [quantize(v, scale) for v in row]
+        body = []
+        for i in range(0, len(q), 13):
+            body.append(", ".join("%d" % v for v in q[i:i + 13]))
+        lines.append("    {" + (",\r\n     ".join(body)) + "}" + ("," if r < len(rows) - 1 else ""))
+    lines.append("};")
+    return lines
+
+
+def render(mats):
+    surf = build_surfaces(mats)
+    e_inv = [1.0 / (E_AXIS[i + 1] - E_AXIS[i]) for i in range(len(E_AXIS) - 1)]
+    de_inv = [1.0 / (DE_AXIS[i + 1] - DE_AXIS[i]) for i in range(len(DE_AXIS) - 1)]
+    out = [
+        "#ifndef FUZZY_SURFACE_H",
+        "#define FUZZY_SURFACE_H",
+        "",
+        "// DIBUAT OTOMATIS oleh tools/gen_fuzzy_surface.py dari matriks di fuzzy_pid.c",
+        "// - jangan diedit manual.",
+        "",
+        "#include <stdint.h>",
+        "",
+        "#define FUZZY_SURFACE_E_POINTS  %d" % len(E_AXIS),
+        "#define FUZZY_SURFACE_DE_POINTS %d" % len(DE_AXIS),
+        "",
+        "// Sumbu grid (e_filtered, de_filtered) dan kebalikan lebar tiap sel",
+    ]
+    out += fmt_axis("fuzzy_surface_e_axis", E_AXIS)
+    out += fmt_axis("fuzzy_surface_e_inv", e_inv)
+    out += fmt_axis("fuzzy_surface_de_axis", DE_AXIS)
+    out += fmt_axis("fuzzy_surface_de_inv", de_inv)
+    out += [
+        "",
+        "// Gain hasil inferensi sebelum adaptasi Ki dan pembatasan: nilai = raw * skala",
+    ]
+    for gain in GAINS:
+        out.append("#define FUZZY_SURFACE_%s_SCALE  %.9ef" % (gain, gain_scale(mats, gain)))
+    for lower, mode in MODES:
+        for gain in GAINS:
+            out.append("")
+            out += fmt_surface("fuzzy_surface_%s_%s" % (gain.lower(), lower),
+                               surf[(gain, mode)], gain_scale(mats, gain))
+    out += ["", "#endif"]
+    return "\r\n".join(out)
+
+
+# --- Pemeriksaan (meniru interpolasi di fuzzy_pid.c) ---
+def find_cell(axis, x):
+    lo, hi = 0, len(axis) - 2
+    while lo < hi:
+        mid = (lo + hi + 1) // 2
+        if axis[mid] <= x:
+            lo = mid
+        else:
+            hi = mid - 1
+    return lo
+
+
+def bilinear(rows, i, j, fx, fy):
+    return ((rows[i][j] * (1.0 - fx) + rows[i + 1][j] * fx) * (1.0 - fy) +
+            (rows[i][j + 1] * (1.0 - fx) + rows[i + 1][j + 1] * fx) * fy)
+
+
+def check(mats):
+    surf = build_surfaces(mats)
+    quant = {}
+    for key, rows in surf.items():
+        scale = gain_scale(mats, key[0])
+        quant[key] = [[quantize(v, scale) * scale for v in row] for row in rows]
+
+    # Titik uji di dalam (-1, 1), digeser dari grid agar interpolasi benar-benar diuji
+    pts = [clamp_edge(-1.0 + 2.0 * (k + 0.37) / CHECK_POINTS) for k in range(CHECK_POINTS)]
+    e_cells = [(find_cell(E_AXIS, x), x) for x in pts]
+    de_cells = [(find_cell(DE_AXIS, x), x) for x in pts]
+    e_mfs = [e_mf(x) for x in pts]
+    de_mfs = [de_mf(x) for x in pts]
+
+    ok = True
+    for _, mode in MODES:
+        dev = [0.0, 0.0, 0.0]
+        for a, (i, e) in enumerate(e_cells):
+            fx = (e - E_AXIS[i]) / (E_AXIS[i + 1] - E_AXIS[i])
+            for b, (j, de) in enumerate(de_cells):
+                exact = inference(mats, mode, e_mfs[a], de_mfs[b])
+                fy = (de - DE_AXIS[j]) / (DE_AXIS[j + 1] - DE_AXIS[j])
+                for k, gain in enumerate(GAINS):
+                    got = bilinear(quant[(gain, mode)], i, j, fx, fy)
+                    dev[k] = max(dev[k], abs(got - exact[k]))
+        for k, gain in enumerate(GAINS):
+            limit = MAX_DEV_FRAC * 65535.0 * gain_scale(mats, gain)
+            print("%-7s %s: deviasi maks %.4f (batas %.4f)" % (mode, gain, dev[k], limit))
+            ok &= dev[k] <= limit
+
+    current = open(HEADER_OUT, encoding="utf-8", newline="").read() if os.path.exists(HEADER_OUT) else ""
+    if current != render(mats):
+        print("fuzzy_surface.h usang: jalankan gen_fuzzy_surface.py")
+        ok = False
+    return ok
+
+
+def write(mats):
+    text = render(mats)
+    if os.path.exists(HEADER_OUT) and open(HEADER_OUT, encoding="utf-8", newline="").read() == text:
+        return
+    with open(HEADER_OUT, "w", encoding="utf-8", newline="") as f:
+        f.write(text)
+    print("gen_fuzzy_surface: fuzzy_surface.h diperbarui")
+
+
+if IN_SCONS:
+    write(read_matrices())
+elif __name__ == "__main__":
+    matrices = read_matrices()
+    if "--check" in sys.argv[1:]:
+        sys.exit(0 if check(matrices) else 1)
+    write(matrices)
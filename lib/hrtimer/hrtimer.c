@@ -0,0 +1,227 @@
+#include "hrtimer.h"
+#include "delay.h"
+#include <stddef.h>
+
+#define HRTIMER_TIMER       TIMER2
+#define HRTIMER_MIN_DELTA_US 2      // Lebih dekat dari ini langsung dipicu software
+
+static hrtimer_t *_queue = NULL;            // Terurut berdasarkan expires_us
+static volatile uint32_t _overflows = 0;    // 16 bit atas waktu us
+static bool _initialized = false;
+
+#define TIME_REACHED(now, deadline) ((int32_t)((now) - (deadline)) >= 0)
+
+// --- Critical Section ---
+static inline uint32_t critical_enter(void) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    return primask;
+}
+
+static inline void critical_exit(uint32_t primask) {
+    __set_PRIMASK(primask);
+}
+
+// Clock TIMER2 = 2x APB1 jika prescaler APB1 bukan /1
+static uint32_t hrtimer_timer_clock(void) {
+    uint32_t clock = rcu_clock_freq_get(CK_APB1);
+    if ((RCU_CFG0 & RCU_CFG0_APB1PSC) != RCU_APB1_CKAHB_DIV1) {
+        clock *= 2;
+    }
+    return clock;
+}
+
+void hrtimer_init(void) {
+    timer_parameter_struct timer_cfg;
+
+    rcu_periph_clock_enable(RCU_TIMER2);
+    timer_deinit(HRTIMER_TIMER);
+    timer_struct_para_init(&timer_cfg);
+    timer_cfg.prescaler         = (uint16_t)(hrtimer_timer_clock() / 1000000U - 1U);
+    timer_cfg.alignedmode       = TIMER_COUNTER_EDGE;
+    timer_cfg.counterdirection  = TIMER_COUNTER_UP;
+    timer_cfg.period            = 0xFFFF;
+    timer_cfg.clockdivision     = TIMER_CKDIV_DIV1;
+    timer_cfg.repetitioncounter = 0;
+    timer_init(HRTIMER_TIMER, &timer_cfg);
+
+    // CH0 hanya sebagai compare (tanpa pin output)
+    timer_channel_output_mode_config(HRTIMER_TIMER, TIMER_CH_0, TIMER_OC_MODE_TIMING);
+    timer_channel_output_shadow_config(HRTIMER_TIMER, TIMER_CH_0, TIMER_OC_SHADOW_DISABLE);
+
+    _queue = NULL;
+    _overflows = 0;
+    timer_interrupt_flag_clear(HRTIMER_TIMER, TIMER_INT_FLAG_UP | TIMER_INT_FLAG_CH0);
+    timer_interrupt_enable(HRTIMER_TIMER, TIMER_INT_UP);
+    nvic_irq_enable(TIMER2_IRQn, HRTIMER_IRQ_PRIORITY, 0);
+    timer_enable(HRTIMER_TIMER);
+    _initialized = true;
+}
+
+uint32_t hrtimer_now_us(void) {
+    uint32_t primask = critical_enter();
+    uint32_t high = _overflows;
+    uint32_t count = timer_counter_read(HRTIMER_TIMER);
+
+    // Overflow yang belum dilayani ISR: baca ulang counter setelah wrap
+    if (timer_flag_get(HRTIMER_TIMER, TIMER_FLAG_UP) != RESET) {
+        high++;
+        count = timer_counter_read(HRTIMER_TIMER);
+    }
+    critical_exit(primask);
+    return (high << 16) | (count & 0xFFFF);
+}
+
+// Set compare CH0 untuk kepala antrian (dipanggil di dalam critical section)
+static void hrtimer_program(void) {
+    hrtimer_t *head = _queue;
+    if (head == NULL) {
+        timer_interrupt_disable(HRTIMER_TIMER, TIMER_INT_CH0);
+        return;
+    }
+
+    int32_t delta = (int32_t)(head->expires_us - hrtimer_now_us());
+    if (delta >= 0x10000) {
+        // Lebih dari satu putaran counter: dicek ulang di interupsi update
+        timer_interrupt_disable(HRTIMER_TIMER, TIMER_INT_CH0);
+        return;
+    }
+
+    timer_interrupt_flag_clear(HRTIMER_TIMER, TIMER_INT_FLAG_CH0);
+    timer_interrupt_enable(HRTIMER_TIMER, TIMER_INT_CH0);
+    if (delta >= HRTIMER_MIN_DELTA_US) {
+        timer_channel_output_pulse_value_config(HRTIMER_TIMER, TIMER_CH_0, (uint16_t)head->expires_us);
+        // Counter bisa melewati nilai compare selama penulisan di atas
+        delta = (int32_t)(head->expires_us - hrtimer_now_us());
+    }
+    if (delta < HRTIMER_MIN_DELTA_US) {
+        timer_event_software_generate(HRTIMER_TIMER, TIMER_EVENT_SRC_CH0G);
+    }
+}
+
+// Jalankan semua timer yang jatuh tempo (konteks ISR TIMER2)
+static void hrtimer_run_expired(void) {
+    for (;;) {
+        uint32_t primask = critical_enter();
+        hrtimer_t *head = _queue;
+        if (head == NULL || !TIME_REACHED(hrtimer_now_us(), head->expires_us)) {
+            hrtimer_program();
+            critical_exit(primask);
+            return;
+        }
+        _queue = head->next;
+        head->next = NULL;
+        head->active = false;
+        critical_exit(primask);
+
+        // Callback boleh menjadwalkan ulang timer yang sama
+        head->cb(head, head->arg);
+    }
+}
+
+void TIMER2_IRQHandler(void) {
+    if (timer_interrupt_flag_get(HRTIMER_TIMER, TIMER_INT_FLAG_UP) != RESET) {
+        timer_interrupt_flag_clear(HRTIMER_TIMER, TIMER_INT_FLAG_UP);
+        _overflows++;
+    }
+    if (timer_interrupt_flag_get(HRTIMER_TIMER, TIMER_INT_FLAG_CH0) != RESET) {
+        timer_interrupt_flag_clear(HRTIMER_TIMER, TIMER_INT_FLAG_CH0);
+    }
+    hrtimer_run_expired();
+}
+
+// Lepas dari antrian (di dalam critical section), true jika kepala berubah
+static bool hrtimer_unlink(hrtimer_t *timer) {
+    hrtimer_t **link = &_queue;
+    while (*link != NULL) {
+        if (*link == timer) {
+            bool was_head = (link == &_queue);
+            *link = timer->next;
+            timer->next = NULL;
+            timer->active = false;
+            return was_head;
+        }
+        link = &(*link)->next;
+    }
+    return false;
+}
+
+bool hrtimer_start_at(hrtimer_t *timer, uint32_t expires_us, hrtimer_cb_t cb, void *arg) {
+    if (timer == NULL || cb == NULL || !_initialized) {
+        return false;
+    }
+
+    uint32_t primask = critical_enter();
+    hrtimer_unlink(timer);
+    timer->expires_us = expires_us;
+    timer->cb = cb;
+    timer->arg = arg;
+    timer->active = true;
+
+    // Sisipkan terurut; deadline sama tetap FIFO
+    hrtimer_t **link = &_queue;
+    while (*link != NULL && TIME_REACHED(expires_us, (*link)->expires_us)) {
+        link = &(*link)->next;
+    }
+    timer->next = *link;
+    *link = timer;
+
+    if (_queue == timer) {
+        hrtimer_program();
+    }
+    critical_exit(primask);
+    return true;
+}
+
+bool hrtimer_start(hrtimer_t *timer, uint32_t delay_us, hrtimer_cb_t cb, void *arg) {
+    return hrtimer_start_at(timer, hrtimer_now_us() + delay_us, cb, arg);
+}
+
+bool hrtimer_cancel(hrtimer_t *timer) {
+    if (timer == NULL) {
+        return false;
+    }
+
+    uint32_t primask = critical_enter();
+    bool was_active = timer->active;
+    if (hrtimer_unlink(timer)) {
+        hrtimer_program();
+    }
+    critical_exit(primask);
+    return was_active;
+}
+
+static void hrtimer_event_cb(hrtimer_t *timer, void *arg) {
+    (void)arg;
+    task_post_event(timer->task_id, timer->event_mask);
+}
+
+bool hrtimer_start_event(hrtimer_t *timer, uint32_t delay_us, uint16_t task_id, uint32_t event_mask) {
+    if (timer == NULL) {
+        return false;
+    }
+    // Timer lama dibatalkan dulu agar task_id/mask tidak berubah saat masih aktif
+    hrtimer_cancel(timer);
+    timer->task_id = task_id;
+    timer->event_mask = event_mask;
+    return hrtimer_start(timer, delay_us, hrtimer_event_cb, NULL);
+}
+
+static void hrtimer_wake_cb(hrtimer_t *timer, void *arg) {
+    // Cukup membangunkan core; 'active' sudah di-clear sebelum callback
+    (void)timer;
+    (void)arg;
+}
+
+void hrtimer_delay_us(uint32_t us) {
+    if (us < HRTIMER_SLEEP_MIN_US || !_initialized) {
+        delay_us(us);
+        return;
+    }
+
+    hrtimer_t timer = {0};
+    hrtimer_start(&timer, us, hrtimer_wake_cb, NULL);
+    while (timer.active) {
+        __WFI();
+    }
+}
@@ -0,0 +1,46 @@
+#ifndef HRTIMER_H
+#define HRTIMER_H
+
+#include <stdint.h>
+#include <gd32f3x0.h>
+
+// Timer resolusi 1 us di TIMER2 (16-bit, diperluas ke 32-bit lewat interupsi update).
+// Callback dijalankan di konteks ISR TIMER2, jadi harus singkat.
+
+// --- Konfigurasi (bisa di-override lewat build_flags) ---
+#ifndef HRTIMER_IRQ_PRIORITY
+#define HRTIMER_IRQ_PRIORITY    1
+#endif
+#ifndef HRTIMER_SLEEP_MIN_US
+#define HRTIMER_SLEEP_MIN_US    20      // Di bawah ini hrtimer_delay_us memakai delay_us biasa
+#endif
+
+typedef struct hrtimer hrtimer_t;
+typedef void (*hrtimer_cb_t)(hrtimer_t *timer, void *arg);
+
+// Node milik pemanggil; jangan diubah selama 'active'
+struct hrtimer {
+    uint32_t expires_us;        // Waktu absolut (hrtimer_now_us)
+    hrtimer_cb_t cb;
+    void *arg;
+    uint16_t task_id;           // Untuk hrtimer_start_event
+    uint32_t event_mask;
+    volatile bool active;
+    hrtimer_t *next;
+};
+
+void hrtimer_init(void);
+uint32_t hrtimer_now_us(void);
+
+// One-shot; callback boleh memanggil hrtimer_start lagi untuk periodik
+bool hrtimer_start(hrtimer_t *timer, uint32_t delay_us, hrtimer_cb_t cb, void *arg);
+bool hrtimer_start_at(hrtimer_t *timer, uint32_t expires_us, hrtimer_cb_t cb, void *arg);
+bool hrtimer_cancel(hrtimer_t *timer);
+
+// Bangunkan task lewat task_post_event setelah delay_us (misalnya TASK_CO_AWAIT_EVENT)
+bool hrtimer_start_event(hrtimer_t *timer, uint32_t delay_us, uint16_t task_id, uint32_t event_mask);
+
+// Pengganti delay_us untuk driver: core tidur (WFI) sampai timer habis, bukan spin DWT
+void hrtimer_delay_us(uint32_t us);
+
+#endif
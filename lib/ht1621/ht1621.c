@@ -252,28 +252,62 @@ void display_toggle_symbols_bulk(const uint8_t* symbols, uint8_t count) {
     }
 }
 
-void display_startup_animation(void) {
-    for (uint8_t i = 0; i < (SINGLE_SYMBOL_COUNT + PACKED_SYMBOL_COUNT); i++) {
-        uint8_t addr = symbol_config[i].address;
-        uint8_t mask = symbol_config[i].bit_mask;
-        symbol_buffer[addr] |= mask;
+// Frame animasi startup, dipakai versi blocking dan coroutine:
+// frame 0 semua simbol menyala, frame 1..10 hitung mundur 9..0 di digit dan bar.
+#define ANIMATION_FRAME_COUNT 11
+
+// Gambar satu frame, kembalikan lama tampil (ms)
+static uint16_t animation_draw_frame(uint8_t frame) {
+    if (frame == 0) {
+        for (uint8_t i = 0; i < (SINGLE_SYMBOL_COUNT + PACKED_SYMBOL_COUNT); i++) {
+            uint8_t addr = symbol_config[i].address;
+            uint8_t mask = symbol_config[i].bit_mask;
+            symbol_buffer[addr] |= mask;
+        }
+        display_update_symbols();
+        return 500;
+    }
+
+    uint8_t value = (uint8_t)(ANIMATION_FRAME_COUNT - 1 - frame);
+    uint8_t seg = seg_table[value];
+    for (uint8_t pos = 0; pos < DIGIT_COUNT; pos++) {
+        digit_buffer[pos] = seg;
     }
+    display_update_digits();
+
+    uint8_t bar_level = (value > 5) ? 6 : value;
+    bar_set(BAR_LEFT, bar_level);
+    bar_set(BAR_RIGHT, bar_level);
     display_update_symbols();
-    delay_ms(500);
+    return 200;
+}
 
-    for (int8_t value = 9; value >= 0; value--) {
-        uint8_t seg = seg_table[value];
-        for (uint8_t pos = 0; pos < DIGIT_COUNT; pos++) {
-            digit_buffer[pos] = seg;
-        }
-        display_update_digits();
+void display_startup_animation(void) {
+    for (uint8_t frame = 0; frame < ANIMATION_FRAME_COUNT; frame++) {
+        delay_ms(animation_draw_frame(frame));
+    }
+    ht1621_clear_all();
+}
 
-        uint8_t bar_level = (value > 5) ? 6 : value;
-        bar_set(BAR_LEFT, bar_level);
-        bar_set(BAR_RIGHT, bar_level);
-        display_update_symbols();
+// --- Versi non-blocking (coroutine) ---
+static volatile bool animation_active = false;
 
-        delay_ms(200);
+bool display_animation_active(void) {
+    return animation_active;
+}
+
+// Jalankan dengan task_start_coroutine(display_startup_animation_task, 0, prio)
+task_co_status_t display_startup_animation_task(task_t *self) {
+    static uint8_t frame;
+
+    TASK_CO_BEGIN(self);
+    animation_active = true;
+
+    for (frame = 0; frame < ANIMATION_FRAME_COUNT; frame++) {
+        TASK_CO_AWAIT_MS(self, animation_draw_frame(frame));
     }
     ht1621_clear_all();
+
+    animation_active = false;
+    TASK_CO_END(self);
 }
\ No newline at end of file
@@ -2,6 +2,7 @@
 #define HT1621_H
 
 #include <stdint.h>
+#include "delay.h"
 
 // === Konfigurasi Pin (SESUAIKAN DENGAN BOARD ANDA) ===
 #define HT_PORT        GPIOB
@@ -58,5 +59,7 @@ void display_set_symbols_bulk(const uint8_t* symbols, uint8_t count, uint8_t sta
 void display_toggle_symbols_bulk(const uint8_t* symbols, uint8_t count);
 
 void display_startup_animation(void);
+task_co_status_t display_startup_animation_task(task_t *self);
+bool display_animation_active(void);
 
 #endif
\ No newline at end of file
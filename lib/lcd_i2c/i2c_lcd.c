@@ -1,5 +1,6 @@
 #include "i2c_lcd.h"
 #include "delay.h"
+#include "hrtimer.h"
 #include <stdint.h>
 #include <stdio.h>
 #include "stdarg.h"
@@ -148,7 +149,7 @@ static void lcd_send_4bits(uint8_t data_bits) {
     output &= ~PCF_EN;
     lcd_write_pcf_with_recovery(output);
     
-    delay_us(50);
+    hrtimer_delay_us(50);
 }
 
 static void lcd_send_byte(uint8_t value, bool is_data) {
@@ -207,19 +208,19 @@ void lcd_init(void) {
     lcd_send_4bits(0x30);
     delay_ms(5);
     lcd_send_4bits(0x30);
-    delay_us(100);
+    hrtimer_delay_us(100);
     lcd_send_4bits(0x30);
-    delay_us(100);
+    hrtimer_delay_us(100);
     lcd_send_4bits(0x20); // 4-bit mode
-    delay_us(100);
+    hrtimer_delay_us(100);
     
     // Function set: 4-bit, 2-line, 5x8
     lcd_send_command(0x28);
-    delay_us(50);
+    hrtimer_delay_us(50);
     
     // Display off
     lcd_send_command(0x08);
-    delay_us(50);
+    hrtimer_delay_us(50);
     
     // Clear display
     lcd_send_command(0x01);
@@ -227,11 +228,11 @@ void lcd_init(void) {
     
     // Entry mode
     lcd_send_command(0x06);
-    delay_us(50);
+    hrtimer_delay_us(50);
     
     // Display on, cursor off
     lcd_send_command(0x0C);
-    delay_us(50);
+    hrtimer_delay_us(50);
     
     // Buat custom characters
     lcd_create_custom_chars();
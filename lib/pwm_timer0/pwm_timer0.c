@@ -1,11 +1,63 @@
 #include "pwm_timer0.h"
 #include "gd32f3x0.h"
 
-// Frekuensi PWM (5 kHz)
-#define PWM_FREQ_HZ         5000U
 #define SYS_CLK_HZ          108000000U // Asumsi SystemCoreClock = 108 MHz
 
 static uint32_t g_pwm_period = 0; // Disimpan agar bisa hitung duty
+static volatile uint8_t g_forced_off = 0; // Bit per pwm_channel_t
+static volatile uint32_t g_pulse[3];        // Pulse yang diminta (dipulihkan setelah blanking)
+
+#if PWM_BLANK_ENABLE
+#define PWM_TICKS_PER_US    (SYS_CLK_HZ / 1000000U)
+#define PWM_BLANK_SETTLE_TICKS  (PWM_BLANK_SETTLE_US * PWM_TICKS_PER_US)
+
+static volatile uint8_t g_blank_active = 0;
+static uint8_t g_blank_aligned = 0;         // Update sudah jatuh di puncak counter
+static uint32_t g_blank_off_phase;          // Fase saat heater T12 mati (tepi CCR0 naik)
+static uint32_t g_blank_pulse;              // CCR0 saat jendela dimulai
+static volatile pwm_blank_stats_t g_blank_stats;
+#endif
+
+static uint16_t pwm_timer_channel(pwm_channel_t channel) {
+    switch (channel) {
+        case PWM_CH_T12_HEATER:     return TIMER_CH_0; // PA8
+        case PWM_CH_HOT_AIR_HEATER: return TIMER_CH_1; // PA9
+        case PWM_CH_FAN:
+        default:                    return TIMER_CH_2; // PA10
+    }
+}
+
+// Trigger scan ADC regular: TIMER1 edge-aligned dengan periode = satu periode PWM penuh
+// (2 x g_pwm_period tick, naik-turun center-aligned), di-start oleh TRGO TIMER0 sehingga CNT TIMER1 = 0 tepat
+// di lembah. Compare CH1 di CNT = 1 memberi tepat satu trigger per periode di fase tetap,
+// tidak tergantung duty (compare CH0 TIMER0 memberi 2/1/0 trigger tergantung duty).
+// Asumsi: clock TIMER1 (APB1 x2) = clock TIMER0 = SYS_CLK_HZ.
+static void pwm_adc_trigger_init(void) {
+    rcu_periph_clock_enable(RCU_TIMER1);
+
+    timer_parameter_struct timer_cfg;
+    timer_deinit(TIMER1);
+    timer_struct_para_init(&timer_cfg);
+    timer_cfg.prescaler         = 0;
+    timer_cfg.period            = 2u * g_pwm_period - 1u;
+    timer_cfg.alignedmode       = TIMER_COUNTER_EDGE;
+    timer_cfg.counterdirection  = TIMER_COUNTER_UP;
+    timer_cfg.clockdivision     = TIMER_CKDIV_DIV1;
+    timer_init(TIMER1, &timer_cfg);
+
+    // CH1 tanpa pin (PA1 analog): hanya sumber trigger ADC_EXTTRIG_REGULAR_T1_CH1
+    timer_oc_parameter_struct ocpara;
+    timer_channel_output_struct_para_init(&ocpara);
+    ocpara.outputstate  = TIMER_CCX_ENABLE;
+    ocpara.ocpolarity   = TIMER_OC_POLARITY_HIGH;
+    timer_channel_output_config(TIMER1, TIMER_CH_1, &ocpara);
+    timer_channel_output_mode_config(TIMER1, TIMER_CH_1, TIMER_OC_MODE_PWM0);
+    timer_channel_output_pulse_value_config(TIMER1, TIMER_CH_1, 1);
+
+    // Slave event mode: counter mulai saat TIMER0 di-enable (ITI0 = TRGO TIMER0)
+    timer_input_trigger_source_select(TIMER1, TIMER_SMCFG_TRGSEL_ITI0);
+    timer_slave_mode_select(TIMER1, TIMER_SLAVE_MODE_EVENT);
+}
 
 void pwm_timer0_init(void) {
     // 1. Enable clock (Tetap)
@@ -30,18 +82,19 @@ void pwm_timer0_init(void) {
     timer_cfg.prescaler         = prescaler;
     timer_cfg.period            = g_pwm_period;
     
-    // --- RUBAH DISINI: Agar bisa memicu ADC di Lembah ---
+    // --- RUBAH DISINI: Center-aligned (heater aktif di sekitar lembah) ---
     timer_cfg.alignedmode       = TIMER_COUNTER_CENTER_BOTH; 
     timer_cfg.counterdirection  = TIMER_COUNTER_UP; 
     // ---------------------------------------------------
     
     timer_cfg.clockdivision     = TIMER_CKDIV_DIV1;
-    timer_cfg.repetitioncounter = 0;
+    timer_cfg.repetitioncounter = 0;   // Blanking: diset di ISR update pertama di lembah
     timer_init(TIMER0, &timer_cfg);
 
     // --- TAMBAHKAN DISINI: Master Mode Selection ---
-    // Mengirim sinyal TRGO ke ADC setiap kali counter mencapai 0 (Lembah)
-    timer_master_output_trigger_source_select(TIMER0, TIMER_TRI_OUT_SRC_UPDATE);
+    // TRGO = enable: start TIMER0 sekaligus menjalankan TIMER1 (trigger ADC) sefase
+    timer_master_output_trigger_source_select(TIMER0, TIMER_TRI_OUT_SRC_ENABLE);
+    timer_master_slave_mode_config(TIMER0, TIMER_MASTER_SLAVE_MODE_ENABLE);
     // -----------------------------------------------
 
     // 5. Konfigurasi Channel Output (Tetap)
@@ -59,6 +112,18 @@ void pwm_timer0_init(void) {
     timer_channel_output_mode_config(TIMER0, TIMER_CH_1, TIMER_OC_MODE_PWM0);
     timer_channel_output_mode_config(TIMER0, TIMER_CH_2, TIMER_OC_MODE_PWM0);
 
+#if PWM_BLANK_ENABLE
+    // CH3 tanpa pin: compare-nya memicu konversi injected T12 (di luar jangkauan = mati)
+    timer_channel_output_mode_config(TIMER0, TIMER_CH_3, TIMER_OC_MODE_TIMING);
+    timer_channel_output_shadow_config(TIMER0, TIMER_CH_3, TIMER_OC_SHADOW_DISABLE);
+    timer_channel_output_pulse_value_config(TIMER0, TIMER_CH_3, g_pwm_period + 1);
+    timer_interrupt_flag_clear(TIMER0, TIMER_INT_FLAG_UP);
+    timer_interrupt_enable(TIMER0, TIMER_INT_UP);
+    nvic_irq_enable(TIMER0_BRK_UP_TRG_COM_IRQn, IRQ_PRIORITY_HEATER_SAFETY, 0);
+#endif
+
+    pwm_adc_trigger_init();
+
     // --- RUBAH DISINI: Main Output Enable ---
     // Untuk TIMER0, ini WAJIB ENABLE agar PWM muncul di pin PA8/9/10
     timer_primary_output_config(TIMER0, ENABLE);
@@ -90,16 +155,167 @@ void pwm_timer0_set_duty(pwm_channel_t channel, float duty_percent) {
     // Hitung nilai pulse (CCR value)
     uint32_t pulse = (uint32_t)(duty_percent * g_pwm_period / 100.0f);
 
+    pwm_timer0_set_pulse(channel, pulse);
+}
+
+// Batas duty per channel, dalam Q16 %
+static q16_t pwm_max_duty_q16(pwm_channel_t channel) {
+    return (channel == PWM_CH_T12_HEATER) ? Q16(T12_MAX_DUTY) : Q16(HOT_AIR_MAX_DUTY);
+}
+
+void pwm_timer0_set_duty_q16(pwm_channel_t channel, q16_t duty_percent) {
+    duty_percent = q16_clamp(duty_percent, 0, pwm_max_duty_q16(channel));
+
+    // pulse = duty * period / 100; 1/(100 * 2^16) = 167772 / 2^40 (error < 1e-6)
+    uint32_t pulse = (uint32_t)(((uint64_t)duty_percent * g_pwm_period * 167772u) >> 40);
+
+    pwm_timer0_set_pulse(channel, pulse);
+}
+
+uint32_t pwm_timer0_get_period(void) {
+    return g_pwm_period;
+}
+
+float pwm_timer0_get_applied_duty(pwm_channel_t channel) {
+    if (g_pwm_period == 0 || (g_forced_off & (1u << channel))) return 0.0f;
+    return g_pulse[channel] * 100.0f / g_pwm_period;
+}
+
+// Heater T12 sedang ditahan mati oleh jendela blanking
+static inline uint8_t pwm_blanked(pwm_channel_t channel) {
+#if PWM_BLANK_ENABLE
+    return (channel == PWM_CH_T12_HEATER) && g_blank_active;
+#else
+    (void)channel;
+    return 0;
+#endif
+}
+
+void pwm_timer0_set_pulse(pwm_channel_t channel, uint32_t pulse) {
+    if (pulse > g_pwm_period) pulse = g_pwm_period;
+    g_pulse[channel] = pulse;
+    uint8_t bit = (uint8_t)(1u << channel);
+    if (g_forced_off & bit) pulse = 0;
+    if (pwm_blanked(channel)) return;   // pwm_timer0_blank_end yang menulis CCR
+
     // Set nilai compare untuk channel tertentu
-    switch (channel) {
-        case PWM_CH_T12_HEATER:
-            timer_channel_output_pulse_value_config(TIMER0, TIMER_CH_0, pulse); // PA8
-            break;
-        case PWM_CH_HOT_AIR_HEATER:
-            timer_channel_output_pulse_value_config(TIMER0, TIMER_CH_1, pulse); // PA9
-            break;
-        case PWM_CH_FAN:
-            timer_channel_output_pulse_value_config(TIMER0, TIMER_CH_2, pulse); // PA10
-            break;
+    uint16_t ch = pwm_timer_channel(channel);
+    timer_channel_output_pulse_value_config(TIMER0, ch, pulse);
+
+    // ISR fault/blanking bisa menyela di antara cek dan tulis: tulis ulang 0 jika baru aktif
+    if (pulse != 0 && ((g_forced_off & bit) || pwm_blanked(channel))) {
+        timer_channel_output_pulse_value_config(TIMER0, ch, 0);
+    }
+}
+
+// Shadow CCR tidak diaktifkan: CCR 0 langsung berlaku di periode PWM yang sedang berjalan.
+// Dipanggil dari ISR DMA dan ISR watchdog (prioritas lebih tinggi): OR harus atomik,
+// bit yang hilang karena preempsi akan menyalakan heater lagi di set_duty berikutnya.
+void pwm_timer0_force_off(pwm_channel_t channel) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    g_forced_off |= (uint8_t)(1u << channel);
+    __set_PRIMASK(primask);
+    timer_channel_output_pulse_value_config(TIMER0, pwm_timer_channel(channel), 0);
+}
+
+void pwm_timer0_release(pwm_channel_t channel) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    g_forced_off &= (uint8_t)~(1u << channel);
+    __set_PRIMASK(primask);
+}
+
+uint8_t pwm_timer0_forced_off_mask(void) {
+    return g_forced_off;
+}
+
+#if PWM_BLANK_ENABLE
+// Posisi dalam satu periode center-aligned: 0..period naik, period..2*period turun
+static uint32_t pwm_phase_now(void) {
+    uint32_t cnt = TIMER_CNT(TIMER0);
+    if (TIMER_CTL0(TIMER0) & TIMER_CTL0_DIR) {
+        return 2 * g_pwm_period - cnt;
+    }
+    return cnt;
+}
+
+// Update di puncak: heater T12 sudah mati sejak counter naik melewati CCR0
+static void pwm_blank_start(void) {
+    uint32_t pulse = (g_forced_off & (1u << PWM_CH_T12_HEATER)) ? 0 : g_pulse[PWM_CH_T12_HEATER];
+    g_blank_active = 1;
+    timer_channel_output_pulse_value_config(TIMER0, TIMER_CH_0, 0);
+
+    uint32_t cnt = TIMER_CNT(TIMER0);
+    uint32_t off_ticks = (g_pwm_period - pulse) + (g_pwm_period - cnt);
+    uint32_t wait = (off_ticks < PWM_BLANK_SETTLE_TICKS) ? PWM_BLANK_SETTLE_TICKS - off_ticks : 0;
+    if (wait < PWM_TICKS_PER_US) wait = PWM_TICKS_PER_US;  // Compare harus di depan counter
+    uint32_t ccr3 = (cnt > wait) ? cnt - wait : 1;
+
+    g_blank_pulse = pulse;
+    g_blank_off_phase = pulse;
+    timer_channel_output_pulse_value_config(TIMER0, TIMER_CH_3, ccr3);
+}
+
+void pwm_timer0_blank_end(void) {
+    if (!g_blank_active) return;
+    uint32_t pulse = (g_forced_off & (1u << PWM_CH_T12_HEATER)) ? 0 : g_pulse[PWM_CH_T12_HEATER];
+    timer_channel_output_pulse_value_config(TIMER0, TIMER_CH_0, pulse);
+    timer_channel_output_pulse_value_config(TIMER0, TIMER_CH_3, g_pwm_period + 1);
+    g_blank_active = 0;
+
+    // Heater normal menyala lagi di fase 2*period - CCR0; yang lewat dari situ hilang
+    uint32_t phase = pwm_phase_now();
+    uint32_t on_phase = 2 * g_pwm_period - g_blank_pulse;
+    uint32_t lost = (phase > on_phase) ? phase - on_phase : 0;
+    uint32_t window = (phase > g_blank_off_phase) ? phase - g_blank_off_phase : 0;
+    uint16_t window_us = (uint16_t)(window / PWM_TICKS_PER_US);
+
+    g_blank_stats.windows++;
+    g_blank_stats.window_us = window_us;
+    if (window_us > g_blank_stats.window_max_us) g_blank_stats.window_max_us = window_us;
+    g_blank_stats.lost_ticks = (uint16_t)lost;
+}
+
+void pwm_timer0_get_blank_stats(pwm_blank_stats_t *stats) {
+    uint32_t primask = __get_PRIMASK();
+    __disable_irq();
+    stats->windows = g_blank_stats.windows;
+    stats->window_us = g_blank_stats.window_us;
+    stats->window_max_us = g_blank_stats.window_max_us;
+    stats->lost_ticks = g_blank_stats.lost_ticks;
+    __set_PRIMASK(primask);
+    stats->duty_loss_percent = stats->lost_ticks * 100.0f / (2.0f * g_pwm_period * PWM_BLANK_PERIODS);
+}
+
+// Repetition counter 2N-1: satu update per PWM_BLANK_PERIODS periode. Update pertama
+// (repetition 0) terjadi di setiap puncak dan lembah; nilai baru ditulis di lembah agar
+// mulai dimuat di puncak berikutnya, sehingga semua update selanjutnya jatuh di puncak.
+void TIMER0_BRK_UP_TRG_COM_IRQHandler(void) {
+    if (!timer_interrupt_flag_get(TIMER0, TIMER_INT_FLAG_UP)) return;
+    timer_interrupt_flag_clear(TIMER0, TIMER_INT_FLAG_UP);
+
+    uint8_t at_peak = (TIMER_CTL0(TIMER0) & TIMER_CTL0_DIR) != 0;
+    if (!g_blank_aligned) {
+        if (!at_peak) {
+            timer_repetition_value_config(TIMER0, 2 * PWM_BLANK_PERIODS - 1);
+            g_blank_aligned = 1;
+        }
+        return;
+    }
+    if (at_peak) {
+        pwm_blank_start();
     }
-}
\ No newline at end of file
+}
+#else
+void pwm_timer0_blank_end(void) {
+}
+
+void pwm_timer0_get_blank_stats(pwm_blank_stats_t *stats) {
+    stats->windows = 0;
+    stats->window_us = 0;
+    stats->window_max_us = 0;
+    stats->lost_ticks = 0;
+    stats->duty_loss_percent = 0.0f;
+}
+#endif
\ No newline at end of file
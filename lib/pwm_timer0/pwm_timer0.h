@@ -1,6 +1,9 @@
 #ifndef PWM_TIMER0_H
 #define PWM_TIMER0_H
 
+#include <stdint.h>
+#include "qmath.h"
+
 // Jenis channel PWM
 typedef enum {
     PWM_CH_T12_HEATER,
@@ -8,6 +11,57 @@ typedef enum {
     PWM_CH_FAN
 } pwm_channel_t;
 
+// Frekuensi PWM (5 kHz); TIMER1 memicu 1 scan ADC per periode, di lembah center-aligned
+#ifndef PWM_FREQ_HZ
+#define PWM_FREQ_HZ         5000U
+#endif
+
+// Prioritas IRQ (pre-emption NVIC, 0 = tertinggi) untuk semua ISR yang menyentuh latch
+// force_off dan status fault ADC. Watchdog/blanking harus bisa menyela ISR DMA ADC agar
+// heater langsung mati; state bersama diubah di critical section karena urutan ini.
+#ifndef IRQ_PRIORITY_HEATER_SAFETY
+#define IRQ_PRIORITY_HEATER_SAFETY  0   // ADC_CMP (watchdog, akhir injected), TIMER0 update
+#endif
+#ifndef IRQ_PRIORITY_ADC_DMA
+#define IRQ_PRIORITY_ADC_DMA        1   // DMA_CH0: blok ADC selesai (filter, fault, hook kontrol)
+#endif
+#if IRQ_PRIORITY_HEATER_SAFETY >= IRQ_PRIORITY_ADC_DMA
+#error "IRQ_PRIORITY_HEATER_SAFETY harus lebih tinggi (angka lebih kecil) dari IRQ_PRIORITY_ADC_DMA"
+#endif
+
+// Blanking T12: termokopel seri dengan heater, jadi bacaan valid butuh heater mati dan
+// OP07 settle. Setiap PWM_BLANK_PERIODS periode, di puncak counter (heater sudah mati
+// secara alami sejak CCR0) heater T12 ditahan mati, TIMER0 CH3 memicu konversi injected
+// setelah total waktu mati PWM_BLANK_SETTLE_US, lalu ISR ADC memulihkan duty. Waktu mati
+// alami sebelum puncak ikut dihitung, jadi duty hanya hilang jika settle melebihinya.
+// Di adc_sensor, T12 diambil dari konversi injected itu; scan regular T12 tetap dipakai
+// untuk deteksi stuck. Watchdog T12 hanya memantau konversi injected. Blok tanpa sampel
+// blanking mempertahankan nilai T12 sebelumnya. Statistik jendela: pwm_timer0_get_blank_stats.
+#ifndef PWM_BLANK_ENABLE
+#define PWM_BLANK_ENABLE        0
+#endif
+#ifndef PWM_BLANK_PERIODS
+#define PWM_BLANK_PERIODS       25      // Satu jendela per blok ADC (ADC_OVERSAMPLE)
+#endif
+#ifndef PWM_BLANK_SETTLE_US
+#define PWM_BLANK_SETTLE_US     60
+#endif
+#if PWM_BLANK_PERIODS < 1 || PWM_BLANK_PERIODS > 128
+#error "PWM_BLANK_PERIODS harus 1..128 (repetition counter 8 bit)"
+#endif
+#if PWM_BLANK_SETTLE_US > 80
+#error "PWM_BLANK_SETTLE_US maksimal 80 (konversi harus selesai dalam setengah periode PWM)"
+#endif
+
+// Statistik blanking (diisi ISR, dibaca kapan saja)
+typedef struct {
+    uint32_t windows;           // Jendela yang selesai
+    uint16_t window_us;         // Lama heater T12 mati: sejak tepi CCR0 sampai duty dipulihkan
+    uint16_t window_max_us;
+    uint16_t lost_ticks;        // On-time heater yang terpotong jendela terakhir (tick timer)
+    float duty_loss_percent;    // lost_ticks rata-rata per PWM_BLANK_PERIODS periode
+} pwm_blank_stats_t;
+
 // Konstanta
 #define T12_MAX_DUTY        80.0f
 #define HOT_AIR_MAX_DUTY    100.0f
@@ -16,5 +70,21 @@ typedef enum {
 // Fungsi API
 void pwm_timer0_init(void);
 void pwm_timer0_set_duty(pwm_channel_t channel, float duty_percent);
+// Jalur fixed-point: duty % Q16, atau langsung nilai CCR (0..period, tanpa batas *_MAX_DUTY)
+void pwm_timer0_set_duty_q16(pwm_channel_t channel, q16_t duty_percent);
+void pwm_timer0_set_pulse(pwm_channel_t channel, uint32_t pulse);
+uint32_t pwm_timer0_get_period(void);
+// Duty yang benar-benar diterapkan (%): sudah dibatasi *_MAX_DUTY, 0 selama latch force_off
+float pwm_timer0_get_applied_duty(pwm_channel_t channel);
+
+// Latch pengaman: CCR langsung 0 (aman dari ISR) dan set_duty/set_pulse diabaikan
+// sampai pwm_timer0_release
+void pwm_timer0_force_off(pwm_channel_t channel);
+void pwm_timer0_release(pwm_channel_t channel);
+uint8_t pwm_timer0_forced_off_mask(void);
+
+// Blanking (PWM_BLANK_ENABLE): dipanggil ISR ADC saat konversi injected T12 selesai
+void pwm_timer0_blank_end(void);
+void pwm_timer0_get_blank_stats(pwm_blank_stats_t *stats);
 
 #endif
\ No newline at end of file
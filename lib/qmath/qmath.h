@@ -0,0 +1,83 @@
+#ifndef QMATH_H
+#define QMATH_H
+
+#include <stdint.h>
+
+// Aritmetika fixed-point Q16.16 (int32: 15 bit integer + tanda, 16 bit pecahan).
+// Dipakai jalur kontrol tanpa float (CONTROL_FIXED_POINT): suhu dalam C, daya dalam %,
+// gain PID. Rentang +-32767, resolusi 1/65536.
+
+typedef int32_t q16_t;
+
+#define Q16_SHIFT       16
+#define Q16_ONE         ((q16_t)1 << Q16_SHIFT)
+#define Q16_HALF        ((q16_t)1 << (Q16_SHIFT - 1))
+#define Q16_MAX         INT32_MAX
+#define Q16_MIN         INT32_MIN
+
+// Konstanta saat kompilasi (dibulatkan), misalnya Q16(0.1f)
+#define Q16(x)          ((q16_t)((x) * 65536.0f + (((x) >= 0) ? 0.5f : -0.5f)))
+
+static inline q16_t q16_from_int(int32_t a) {
+    return (q16_t)(a * Q16_ONE);
+}
+
+static inline int32_t q16_to_int(q16_t a) {
+    return (a + Q16_HALF) >> Q16_SHIFT;     // Dibulatkan
+}
+
+static inline float q16_to_float(q16_t a) {
+    return (float)a * (1.0f / 65536.0f);
+}
+
+static inline q16_t q16_from_float(float a) {
+    return (q16_t)(a * 65536.0f + ((a >= 0.0f) ? 0.5f : -0.5f));
+}
+
+static inline q16_t q16_sat(int64_t a) {
+    if (a > Q16_MAX) return Q16_MAX;
+    if (a < Q16_MIN) return Q16_MIN;
+    return (q16_t)a;
+}
+
+static inline q16_t q16_mul(q16_t a, q16_t b) {
+    return q16_sat(((int64_t)a * b) >> Q16_SHIFT);
+}
+
+// Pembagian umum (64-bit); untuk pembagi konstan lebih baik kalikan kebalikannya
+static inline q16_t q16_div(q16_t a, q16_t b) {
+    if (b == 0) return (a >= 0) ? Q16_MAX : Q16_MIN;
+    return q16_sat(((int64_t)a << Q16_SHIFT) / b);
+}
+
+static inline q16_t q16_abs(q16_t a) {
+    return (a < 0) ? -a : a;
+}
+
+static inline q16_t q16_min(q16_t a, q16_t b) {
+    return (a < b) ? a : b;
+}
+
+static inline q16_t q16_max(q16_t a, q16_t b) {
+    return (a > b) ? a : b;
+}
+
+static inline q16_t q16_clamp(q16_t a, q16_t lo, q16_t hi) {
+    return (a < lo) ? lo : ((a > hi) ? hi : a);
+}
+
+// Low-pass satu kutub: alpha*target + (1-alpha)*current
+static inline q16_t q16_lerp(q16_t current, q16_t target, q16_t alpha) {
+    return current + q16_mul(target - current, alpha);
+}
+
+// Interpolasi linear tabel seragam Q16; pos = indeks Q16, di luar tabel diekstrapolasi
+static inline q16_t q16_lut_interp(const q16_t *table, uint16_t points, q16_t pos) {
+    int32_t i = pos >> Q16_SHIFT;
+    if (i < 0) i = 0;
+    if (i > points - 2) i = points - 2;
+    q16_t frac = pos - (i << Q16_SHIFT);
+    return table[i] + (q16_t)(((int64_t)(table[i + 1] - table[i]) * frac) >> Q16_SHIFT);
+}
+
+#endif
\ No newline at end of file
@@ -0,0 +1,53 @@
+#ifndef DELAY_TEST_H
+#define DELAY_TEST_H
+
+// Infrastruktur test host untuk lib/delay di atas port DELAY_HOST_SIM.
+// Test meng-include delay.c langsung (white-box) sehingga _tasks[], ring dan timer heap
+// bisa diperiksa. Setiap test adalah program sendiri; exit code != 0 berarti gagal.
+// TEST_CHECK dan test_report juga dipakai test host lain (test_adc_lut).
+
+#include <stdio.h>
+#include <stdint.h>
+
+static unsigned test_checks = 0;
+static unsigned test_failures = 0;
+
+#define TEST_CHECK(cond, ...)                                               \
+    do {                                                                    \
+        test_checks++;                                                      \
+        if (!(cond)) {                                                      \
+            test_failures++;                                                \
+            printf("  FAIL %s:%d: %s: ", __FILE__, __LINE__, #cond);        \
+            printf(__VA_ARGS__);                                            \
+            printf("\n");                                                   \
+        }                                                                   \
+    } while (0)
+
+// Setiap test mulai dari simulator dan scheduler yang bersih
+#define TEST_RUN(fn, core_hz)                                               \
+    do {                                                                    \
+        unsigned failures_before = test_failures;                           \
+        delay_sim_reset(core_hz);                                           \
+        delay_init();                                                       \
+        fn();                                                               \
+        printf("%s %s\n", (test_failures == failures_before) ? "ok  " : "FAIL", #fn); \
+    } while (0)
+
+static inline int test_report(void) {
+    printf("%u checks, %u failures\n", test_checks, test_failures);
+    return (test_failures == 0) ? 0 : 1;
+}
+
+// PRNG deterministik (xorshift32) untuk jitter beban dan jadwal interupsi
+static uint32_t test_rng_state = 0x12345678u;
+
+static inline uint32_t test_rand(uint32_t limit) {
+    uint32_t x = test_rng_state;
+    x ^= x << 13;
+    x ^= x >> 17;
+    x ^= x << 5;
+    test_rng_state = x;
+    return (limit > 0) ? (x % limit) : x;
+}
+
+#endif
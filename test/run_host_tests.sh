@@ -0,0 +1,24 @@
+#!/bin/sh
+# Build dan jalankan test host (gcc di PC, tanpa board) dari root repo:
+#   sh test/run_host_tests.sh
+# Test ini diabaikan oleh `pio test` (test_ignore di platformio.ini).
+set -e
+
+CC=${CC:-gcc}
+OUT=${OUT:-${TMPDIR:-/tmp}/host_tests}
+CFLAGS="-O2 -Wall -Wextra -Itest"
+DELAY_FLAGS="-DDELAY_HOST_SIM -Ilib/delay"
+ADC_FLAGS="-DADC_HOST_TEST -Ilib/adc_sensor -Ilib/qmath -Ilib/pwm_timer0"
+mkdir -p "$OUT"
+
+# nama_test  flag_tambahan  sumber_lib
+run() {
+    name=$1; extra=$2; shift 2
+    echo "== $name"
+    $CC $CFLAGS $extra -o "$OUT/$name" "test/$name/$name.c" "$@"
+    "$OUT/$name"
+}
+
+run test_delay_ring "$DELAY_FLAGS -DDELAY_SIM_PREEMPT_BARRIERS" lib/delay/delay_sim.c
+run test_delay_sched "$DELAY_FLAGS" lib/delay/delay_sim.c
+run test_adc_lut "$ADC_FLAGS" lib/adc_sensor/adc_convert.c -lm
@@ -0,0 +1,141 @@
+// Test konversi lib/adc_sensor/adc_convert.c (tabel adc_lut.h) terhadap rumus tertutup:
+// Beta NTC dan polinomial NIST ITS-90 tipe K (sama dengan tools/gen_adc_lut.py). Setiap
+// jumlah oversampling 0..ADC_MAX_VALUE * ADC_OVERSAMPLE dikonversi lewat jalur float dan
+// Q16.16, error maksimum di rentang kerja harus di bawah batas.
+//
+// Build & jalankan dari root repo:
+//   gcc -O2 -Wall -Wextra -DADC_HOST_TEST -Ilib/adc_sensor -Ilib/qmath -Ilib/pwm_timer0 -Itest
+//       -o test_adc_lut test/test_adc_lut/test_adc_lut.c lib/adc_sensor/adc_convert.c -lm
+//   ./test_adc_lut
+
+#include <math.h>
+#include "adc_sensor.h"
+#include "delay_test.h"
+
+// Batas error (C); tabel sendiri diperiksa gen_adc_lut.py --check dengan 0.2 / 0.1
+#define NTC_MAX_ERR         0.2
+#define TC_MAX_ERR          0.1
+#define Q16_EXTRA_ERR       0.01    // Selisih jalur Q16 terhadap float (lihat adc_sensor.h)
+#define ROUNDTRIP_MAX_ERR   0.2     // Kode ADC dipotong ke bawah: ~0.14 C per LSB
+
+#define SUM_FULL_SCALE      ((uint32_t)(ADC_MAX_VALUE * ADC_OVERSAMPLE))
+
+static const double ambients_c[] = { 0.0, 10.0, 25.0, 40.0, 60.0 };
+#define AMBIENT_COUNT       (sizeof(ambients_c) / sizeof(ambients_c[0]))
+
+// --- Rumus tertutup ---
+static double ref_ntc_temp(double ratio) {
+    double r = NTC_R_SERIES * ratio / (1.0 - ratio);
+    return 1.0 / (1.0 / 298.15 + log(r / NTC_R0) / NTC_BETA) - 273.15;
+}
+
+static const double k_neg[] = {
+    0.0, 0.394501280250e-01, 0.236223735980e-04, -0.328589067840e-06,
+    -0.499048287770e-08, -0.675090591730e-10, -0.574103274280e-12,
+    -0.310888728940e-14, -0.104516093650e-16, -0.198892668780e-19,
+    -0.163226974860e-22
+};
+static const double k_pos[] = {
+    -0.176004136860e-01, 0.389212049750e-01, 0.185587700320e-04,
+    -0.994575928740e-07, 0.318409457190e-09, -0.560728448890e-12,
+    0.560750590590e-15, -0.320207200030e-18, 0.971511471520e-22,
+    -0.121047212750e-25
+};
+
+static double ref_tc_emf_uv(double t) {
+    const double *c = (t < 0.0) ? k_neg : k_pos;
+    int n = (t < 0.0) ? 11 : 10;
+    double mv = 0.0;
+    for (int i = n - 1; i >= 0; i--) {
+        mv = mv * t + c[i];
+    }
+    if (t >= 0.0) {
+        mv += 0.118597600000e+00 * exp(-0.118343200000e-03 * (t - 126.9686) * (t - 126.9686));
+    }
+    return mv * 1000.0;
+}
+
+static double ref_tc_temp(double uv) {
+    double lo = -270.0, hi = 1372.0;
+    for (int i = 0; i < 60; i++) {
+        double mid = 0.5 * (lo + hi);
+        if (ref_tc_emf_uv(mid) < uv) lo = mid; else hi = mid;
+    }
+    return 0.5 * (lo + hi);
+}
+
+// --- Test ---
+static void test_ntc(void) {
+    double err_f = 0.0, err_q = 0.0;
+    for (uint32_t sum = 0; sum <= SUM_FULL_SCALE; sum++) {
+        float v = adc_sum_to_voltage(sum);
+        float t_f = adc_calc_ambient_temp(v);
+        double t_q = q16_to_float(adc_sum_to_ambient_q16(sum));
+        double ratio = (double)sum / SUM_FULL_SCALE;
+        if (v <= 0.05f || v >= ADC_VREF - 0.05f) {
+            // Rel ADC (NTC terbuka/short): nilai aman 25 C di kedua jalur
+            TEST_CHECK(t_f == 25.0f, "sum %u: %.3f", (unsigned)sum, t_f);
+            continue;
+        }
+        double exact = ref_ntc_temp(ratio);
+        if (exact < 0.0 || exact > 70.0) {
+            continue;
+        }
+        err_f = fmax(err_f, fabs(t_f - exact));
+        err_q = fmax(err_q, fabs(t_q - exact));
+    }
+    printf("  NTC 0..70 C: float %.3f C, Q16 %.3f C\n", err_f, err_q);
+    TEST_CHECK(err_f <= NTC_MAX_ERR, "float %.3f", err_f);
+    TEST_CHECK(err_q <= NTC_MAX_ERR + Q16_EXTRA_ERR, "Q16 %.3f", err_q);
+}
+
+static void test_thermocouple(void) {
+    for (unsigned a = 0; a < AMBIENT_COUNT; a++) {
+        double ambient = ambients_c[a];
+        double cj_uv = ref_tc_emf_uv(ambient);
+        q16_t ambient_q = Q16(ambient);
+        double err_f = 0.0, err_q = 0.0;
+        for (uint32_t sum = 0; sum <= SUM_FULL_SCALE; sum++) {
+            float v_tc = adc_compensate_op07_bias(adc_sum_to_voltage(sum));
+            double exact = ref_tc_temp(v_tc * 1e6 + cj_uv);
+            if (exact < 0.0 || exact > 500.0) {
+                continue;
+            }
+            double t_f = adc_calc_thermocouple_temp(v_tc, (float)ambient);
+            double t_q = q16_to_float(adc_sum_to_tc_temp_q16(sum, ambient_q));
+            err_f = fmax(err_f, fabs(t_f - exact));
+            err_q = fmax(err_q, fabs(t_q - exact));
+        }
+        printf("  TC 0..500 C, ambient %4.1f C: float %.3f C, Q16 %.3f C\n", ambient, err_f, err_q);
+        TEST_CHECK(err_f <= TC_MAX_ERR, "ambient %.1f: float %.3f", ambient, err_f);
+        TEST_CHECK(err_q <= TC_MAX_ERR + Q16_EXTRA_ERR, "ambient %.1f: Q16 %.3f", ambient, err_q);
+    }
+}
+
+// Ambang watchdog: kode dari adc_tc_temp_to_code harus kembali ke suhu yang sama
+static void test_tc_code_roundtrip(void) {
+    for (unsigned a = 0; a < AMBIENT_COUNT; a++) {
+        float ambient = (float)ambients_c[a];
+        for (int t = 100; t <= 500; t += 20) {
+            uint16_t code = adc_tc_temp_to_code((float)t, ambient);
+            float back = adc_calc_thermocouple_temp(adc_compensate_op07_bias(adc_raw_to_voltage(code)),
+                                                    ambient);
+            TEST_CHECK(fabs(back - t) <= ROUNDTRIP_MAX_ERR, "%d C ambient %.1f: code %u -> %.3f",
+                       t, ambient, (unsigned)code, back);
+        }
+    }
+}
+
+#define ADC_TEST_RUN(fn)                                                    \
+    do {                                                                    \
+        unsigned failures_before = test_failures;                           \
+        fn();                                                               \
+        printf("%s %s\n", (test_failures == failures_before) ? "ok  " : "FAIL", #fn); \
+    } while (0)
+
+int main(void) {
+    ADC_TEST_RUN(test_ntc);
+    ADC_TEST_RUN(test_thermocouple);
+    ADC_TEST_RUN(test_tc_code_roundtrip);
+    return test_report();
+}
@@ -0,0 +1,203 @@
+// Stress test ring siap SPSC (task_queue_add / task_queue_get_next) di atas waktu virtual.
+// Producer: SysTick_Handler (rilis periodik) dan dua interupsi simulasi yang memanggil
+// task_queue_add langsung. Simulator tidak pernah menumpuk ISR, jadi semuanya tetap satu
+// konteks producer. Consumer: loop thread yang memanggil task_queue_get_next dengan jeda
+// acak. Dengan DELAY_SIM_PREEMPT_BARRIERS setiap __DMB menjadi titik preempsi, sehingga
+// interupsi juga jatuh di tengah push/pop.
+//
+// Build & jalankan dari root repo:
+//   gcc -O2 -Wall -Wextra -DDELAY_HOST_SIM -DDELAY_SIM_PREEMPT_BARRIERS -Ilib/delay -Itest
+//       -o test_delay_ring test/test_delay_ring/test_delay_ring.c lib/delay/delay_sim.c
+//   ./test_delay_ring
+
+#include "delay.h"
+#include "delay_test.h"
+
+// Setiap entri yang dipublikasikan producer dicatat lewat hook rilis
+static void ring_on_release(task_t *task);
+#undef DELAY_TRACE_RELEASE
+#define DELAY_TRACE_RELEASE(task) ring_on_release(task)
+
+#include "delay.c"
+
+#define CORE_HZ         1000000     // 1 siklus = 1 us, IRQ bisa dijadwalkan per siklus
+#define RUN_MS          2000
+#define RING_LOG_MAX    (1u << 21)
+
+typedef struct {
+    uint16_t slot;
+    uint16_t task_id;
+} ring_log_entry_t;
+
+static ring_log_entry_t ring_log[TASK_PRIORITY_COUNT][RING_LOG_MAX];
+static uint32_t pushed[TASK_PRIORITY_COUNT];
+static uint32_t popped[TASK_PRIORITY_COUNT];
+static uint32_t max_depth[TASK_PRIORITY_COUNT];
+static uint32_t slot_pushes[MAX_TASK];
+static uint8_t in_ring[MAX_TASK];
+
+// Task yang dirilis interupsi simulasi (interval sangat panjang, SysTick tidak menyentuhnya)
+static uint16_t isr_slots[MAX_TASK];
+static uint8_t isr_slot_count;
+static uint8_t producers_enabled;
+
+static void dummy_task(void) {
+}
+
+static void ring_test_clear(void) {
+    memset(pushed, 0, sizeof(pushed));
+    memset(popped, 0, sizeof(popped));
+    memset(max_depth, 0, sizeof(max_depth));
+    memset(slot_pushes, 0, sizeof(slot_pushes));
+    memset(in_ring, 0, sizeof(in_ring));
+    isr_slot_count = 0;
+    producers_enabled = 1;
+}
+
+static void ring_on_release(task_t *task) {
+    uint16_t slot = (uint16_t)(task - _tasks);
+    uint8_t prio = (uint8_t)task->priority;
+
+    // Task callback dengan kebijakan SKIP tidak pernah masuk antrian lokal
+    TEST_CHECK(task->queued, "slot %u dirilis di luar ring", slot);
+    TEST_CHECK(!in_ring[slot], "slot %u punya dua entri di ring", slot);
+    in_ring[slot] = 1;
+    slot_pushes[slot]++;
+
+    if (pushed[prio] < RING_LOG_MAX) {
+        ring_log[prio][pushed[prio]].slot = slot;
+        ring_log[prio][pushed[prio]].task_id = task->task_id;
+    }
+    pushed[prio]++;
+
+    uint32_t depth = (uint16_t)(_task_queues[prio].head - _task_queues[prio].tail);
+    if (depth > max_depth[prio]) {
+        max_depth[prio] = depth;
+    }
+}
+
+static void ring_on_pop(task_t *task) {
+    uint16_t slot = (uint16_t)(task - _tasks);
+    uint8_t prio = (uint8_t)task->priority;
+    uint32_t n = popped[prio]++;
+
+    TEST_CHECK(n < pushed[prio], "prio %u: pop tanpa push (slot %u)", prio, slot);
+    TEST_CHECK(in_ring[slot], "slot %u di-pop dua kali", slot);
+    in_ring[slot] = 0;
+    if (n < pushed[prio] && n < RING_LOG_MAX) {
+        TEST_CHECK(ring_log[prio][n].slot == slot && ring_log[prio][n].task_id == task->task_id,
+                   "prio %u urutan ke-%lu: di-push slot %u, di-pop slot %u", prio,
+                   (unsigned long)n, ring_log[prio][n].slot, slot);
+    }
+}
+
+// Dua sumber interupsi dengan periode berbeda memilih task acak untuk dirilis
+static void isr_post(void) {
+    if (!producers_enabled || isr_slot_count == 0) {
+        return;
+    }
+    task_t *task = &_tasks[isr_slots[test_rand(isr_slot_count)]];
+    TEST_CHECK(task_queue_add(task), "task_queue_add gagal (ring penuh)");
+}
+
+static void isr_post_burst(void) {
+    for (uint8_t i = 0; i < 3; i++) {
+        isr_post();
+    }
+}
+
+static void start_isr_task(task_priority_t priority) {
+    uint16_t id = task_start_ex(dummy_task, 0x40000000UL, priority, false);
+    isr_slots[isr_slot_count++] = (uint16_t)(find_task_by_id(id) - _tasks);
+}
+
+// Consumer: pop dengan jeda acak lalu kuras sisa ring dengan interupsi mati
+static void ring_consume(uint32_t run_ms, uint32_t max_gap_cycles) {
+    uint64_t end = delay_sim_cycles() + (uint64_t)run_ms * (CORE_HZ / 1000);
+    while (delay_sim_cycles() < end) {
+        task_t *task = task_queue_get_next();
+        if (task != NULL) {
+            ring_on_pop(task);
+        }
+        delay_sim_consume_cycles(test_rand(max_gap_cycles));
+    }
+
+    producers_enabled = 0;
+    __disable_irq();
+    task_t *task;
+    while ((task = task_queue_get_next()) != NULL) {
+        ring_on_pop(task);
+    }
+    __enable_irq();
+
+    for (int p = 0; p < TASK_PRIORITY_COUNT; p++) {
+        TEST_CHECK(popped[p] == pushed[p], "prio %d: %lu push, %lu pop", p,
+                   (unsigned long)pushed[p], (unsigned long)popped[p]);
+        TEST_CHECK(_task_queues[p].head == _task_queues[p].tail, "prio %d: ring tidak kosong", p);
+        TEST_CHECK(_task_queues[p].overflows == 0, "prio %d: ring overflow", p);
+        TEST_CHECK(pushed[p] < RING_LOG_MAX, "prio %d: log terlalu kecil", p);
+    }
+}
+
+// Setiap deadline periodik harus menjadi satu entri ring atau satu overrun
+static void check_periodic_releases(const uint16_t *ids, uint8_t count, uint32_t start_ms) {
+    uint32_t elapsed = systick_millis - start_ms;
+    for (uint8_t i = 0; i < count; i++) {
+        task_t *task = find_task_by_id(ids[i]);
+        TEST_CHECK(task != NULL, "task %u hilang", ids[i]);
+        if (task == NULL) continue;
+        uint16_t slot = (uint16_t)(task - _tasks);
+        uint32_t expected = elapsed / task->interval_ms;
+        TEST_CHECK(slot_pushes[slot] + task->overruns == expected,
+                   "task %u: %lu rilis + %lu overrun, deadline %lu", ids[i],
+                   (unsigned long)slot_pushes[slot], (unsigned long)task->overruns,
+                   (unsigned long)expected);
+    }
+}
+
+// Rilis SysTick dan ISR bercampur di keempat prioritas
+static void test_mixed_priorities(void) {
+    static const uint32_t intervals[] = {1, 1, 2, 3, 1, 2, 5, 1};
+    uint16_t ids[8];
+
+    ring_test_clear();
+    uint32_t start_ms = systick_millis;
+    for (uint8_t i = 0; i < 8; i++) {
+        ids[i] = task_start_ex(dummy_task, intervals[i], (task_priority_t)(i % TASK_PRIORITY_COUNT), false);
+    }
+    for (uint8_t i = 0; i < 6; i++) {
+        start_isr_task((task_priority_t)(i % TASK_PRIORITY_COUNT));
+    }
+    delay_sim_add_periodic_irq(3, 1, isr_post);
+    delay_sim_add_periodic_irq(7, 2, isr_post_burst);
+
+    ring_consume(RUN_MS, 16);
+    check_periodic_releases(ids, 8, start_ms);
+}
+
+// Semua slot di satu prioritas dengan consumer lambat: ring terisi sampai kapasitas
+static void test_single_priority_full(void) {
+    uint16_t ids[4];
+
+    ring_test_clear();
+    uint32_t start_ms = systick_millis;
+    for (uint8_t i = 0; i < 4; i++) {
+        ids[i] = task_start_ex(dummy_task, 1 + i, TASK_PRIORITY_NORMAL, false);
+    }
+    while (isr_slot_count < MAX_TASK - 4) {
+        start_isr_task(TASK_PRIORITY_NORMAL);
+    }
+    delay_sim_add_periodic_irq(2, 1, isr_post_burst);
+    delay_sim_add_periodic_irq(5, 3, isr_post);
+
+    ring_consume(RUN_MS, 200);
+    check_periodic_releases(ids, 4, start_ms);
+    TEST_CHECK(max_depth[TASK_PRIORITY_NORMAL] == MAX_TASK, "kedalaman maks %lu",
+               (unsigned long)max_depth[TASK_PRIORITY_NORMAL]);
+}
+
+int main(void) {
+    TEST_RUN(test_mixed_priorities, CORE_HZ);
+    TEST_RUN(test_single_priority_full, CORE_HZ);
+    return test_report();
+}
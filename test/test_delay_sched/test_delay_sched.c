@@ -0,0 +1,504 @@
+// Test perilaku scheduler lib/delay di atas waktu virtual: urutan timer heap, kebijakan
+// overrun, budget mode drain, waktu bangun tickless idle dan tabel task statis.
+//
+// Build & jalankan dari root repo:
+//   gcc -O2 -Wall -Wextra -DDELAY_HOST_SIM -Ilib/delay -Itest
+//       -o test_delay_sched test/test_delay_sched/test_delay_sched.c lib/delay/delay_sim.c
+//   ./test_delay_sched
+
+#include "delay.h"
+#include "delay_test.h"
+
+// Rilis dari SysTick harus tepat di deadline-nya
+static void sched_on_release(task_t *task);
+#undef DELAY_TRACE_RELEASE
+#define DELAY_TRACE_RELEASE(task) sched_on_release(task)
+
+#include "delay.c"
+
+static uint8_t check_release_deadline;
+static uint32_t late_releases;
+
+static void sched_on_release(task_t *task) {
+    // Rilis lewat ring selalu dari SysTick_Handler, saat deadline_ms belum dimajukan
+    if (check_release_deadline && task->queued && !task->backlog_queued &&
+        systick_millis != task->deadline_ms) {
+        late_releases++;
+    }
+}
+
+static uint64_t cycles_per_ms(void) {
+    return SystemCoreClock / 1000;
+}
+
+// Main loop seperti src/bckp: jalankan task siap lalu tidur sampai interupsi berikutnya
+static void run_for_ms(uint32_t ms) {
+    uint64_t end = delay_sim_cycles() + (uint64_t)ms * cycles_per_ms();
+    while (delay_sim_cycles() < end) {
+        task_scheduler_run();
+        task_scheduler_idle();
+    }
+}
+
+// --- Timer heap ---
+static void check_heap(void) {
+    uint16_t armed = 0;
+    for (int i = 0; i < MAX_TASK; i++) {
+        if (_tasks[i].heap_index != TIMER_HEAP_NONE) {
+            armed++;
+        }
+    }
+    TEST_CHECK(armed == _timer_heap_count, "%u task ter-arm, heap berisi %u", armed, _timer_heap_count);
+
+    for (uint16_t i = 0; i < _timer_heap_count; i++) {
+        task_t *task = _timer_heap[i];
+        TEST_CHECK(task->heap_index == i, "heap[%u] menyimpan heap_index %u", i, task->heap_index);
+        if (i > 0) {
+            task_t *parent = _timer_heap[(i - 1) / 2];
+            TEST_CHECK(!TIME_BEFORE(task->deadline_ms, parent->deadline_ms),
+                       "heap[%u] deadline %lu sebelum parent %lu", i,
+                       (unsigned long)task->deadline_ms, (unsigned long)parent->deadline_ms);
+        }
+    }
+    // Semua yang jatuh tempo sudah dirilis SysTick
+    if (_timer_heap_count > 0) {
+        TEST_CHECK(TIME_BEFORE(systick_millis, _timer_heap[0]->deadline_ms),
+                   "deadline %lu terlewat (now %lu)", (unsigned long)_timer_heap[0]->deadline_ms,
+                   (unsigned long)systick_millis);
+    }
+}
+
+static void quick_task(void) {
+    delay_sim_consume_cycles(test_rand(200));
+}
+
+// Operasi acak start/stop/suspend/resume melintasi overflow systick_millis
+static void test_heap_order(void) {
+    uint16_t ids[MAX_TASK];
+    uint8_t count = 0;
+
+    systick_millis = 0xFFFFF000UL;
+    late_releases = 0;
+    check_release_deadline = 1;
+
+    for (uint32_t round = 0; round < 20000; round++) {
+        uint32_t op = test_rand(6);
+        if (op == 0 && count < MAX_TASK) {
+            uint16_t id = task_start_ex(quick_task, 1 + test_rand(40), (task_priority_t)test_rand(TASK_PRIORITY_COUNT),
+                                        test_rand(2) != 0);
+            if (id != INVALID_TASK_ID) {
+                ids[count++] = id;
+            }
+        } else if (op == 1 && count > 0) {
+            uint8_t i = (uint8_t)test_rand(count);
+            task_stop_by_id(ids[i]);
+            ids[i] = ids[--count];
+        } else if (op == 2 && count > 0) {
+            task_suspend_by_id(ids[test_rand(count)]);
+        } else if (op == 3 && count > 0) {
+            task_resume_by_id(ids[test_rand(count)]);
+        } else {
+            task_scheduler_run();
+            delay_sim_consume_cycles(test_rand(3 * cycles_per_ms()));
+        }
+        check_heap();
+
+        // Oneshot yang sudah dijalankan melepas slotnya
+        for (uint8_t i = 0; i < count; ) {
+            if (find_task_by_id(ids[i]) == NULL) {
+                ids[i] = ids[--count];
+            } else {
+                i++;
+            }
+        }
+    }
+
+    check_release_deadline = 0;
+    TEST_CHECK(late_releases == 0, "%lu rilis tidak tepat di deadline", (unsigned long)late_releases);
+    TEST_CHECK(systick_millis < 0xFFFFF000UL, "systick_millis tidak melewati overflow");
+}
+
+// --- Kebijakan overrun ---
+// Periode 10 ms, eksekusi ke-3 memblok 35 ms (melewati tiga deadline)
+static uint32_t slow_runs;
+static uint32_t slow_activations;
+static uint32_t slow_max_period;
+
+static void slow_task(void) {
+    slow_runs++;
+    slow_activations += task_current_activations();
+    if (task_current_period_ms() > slow_max_period) {
+        slow_max_period = task_current_period_ms();
+    }
+    delay_sim_consume_us((slow_runs == 3) ? 35000 : 1000);
+}
+
+static uint16_t start_slow_task(task_overrun_policy_t policy) {
+    slow_runs = 0;
+    slow_activations = 0;
+    slow_max_period = 0;
+    uint16_t id = task_start_ex(slow_task, 10, TASK_PRIORITY_NORMAL, false);
+    task_set_overrun_policy(id, policy);
+    run_for_ms(205);    // Deadline 10..200 ms
+    return id;
+}
+
+static void test_overrun_skip(void) {
+    uint16_t id = start_slow_task(TASK_OVERRUN_SKIP);
+    uint32_t missed = task_get_missed_activations(id);
+    TEST_CHECK(missed > 0, "tidak ada aktivasi terlewat");
+    TEST_CHECK(slow_runs + missed == 20, "%lu eksekusi + %lu terlewat", (unsigned long)slow_runs,
+               (unsigned long)missed);
+    TEST_CHECK(slow_activations == slow_runs, "SKIP menggabung aktivasi");
+    // Fase tetap: rilis berikutnya tetap di kelipatan 10 ms
+    TEST_CHECK(slow_max_period == 30, "periode aktual maks %lu ms", (unsigned long)slow_max_period);
+}
+
+static void test_overrun_catchup(void) {
+    uint16_t id = start_slow_task(TASK_OVERRUN_CATCHUP);
+    TEST_CHECK(slow_runs == 20, "%lu eksekusi", (unsigned long)slow_runs);
+    TEST_CHECK(task_get_missed_activations(id) == 0, "%lu aktivasi terlewat",
+               (unsigned long)task_get_missed_activations(id));
+    TEST_CHECK(find_task_by_id(id)->caught_up > 0, "tidak ada eksekusi catch-up");
+    // Catch-up memakai rilis logis (sebelumnya + interval)
+    TEST_CHECK(slow_max_period == 10, "periode aktual maks %lu ms", (unsigned long)slow_max_period);
+}
+
+static void test_overrun_coalesce(void) {
+    start_slow_task(TASK_OVERRUN_COALESCE);
+    TEST_CHECK(slow_runs < 20, "%lu eksekusi", (unsigned long)slow_runs);
+    TEST_CHECK(slow_activations == 20, "%lu aktivasi dilaporkan", (unsigned long)slow_activations);
+    TEST_CHECK(slow_max_period == 30, "periode aktual maks %lu ms", (unsigned long)slow_max_period);
+}
+
+// Consumer tidak jalan selama 55 ms: deadline 20..50 jatuh saat task masih di ring,
+// jadi hanya rilis 10 ms yang masuk ring; sisanya overrun, bukan rilis
+static void test_release_while_queued(void) {
+    uint16_t id = task_start_ex(slow_task, 10, TASK_PRIORITY_NORMAL, false);
+    delay_reset_isr_stats();
+    delay_sim_consume_cycles(55 * cycles_per_ms());
+
+    systick_isr_stats_t isr;
+    delay_get_isr_stats(&isr);
+    TEST_CHECK(isr.releases == 1, "%lu rilis", (unsigned long)isr.releases);
+    TEST_CHECK(task_queue_count(TASK_PRIORITY_NORMAL) == 1, "%u entri di ring",
+               task_queue_count(TASK_PRIORITY_NORMAL));
+    TEST_CHECK(find_task_by_id(id)->overruns == 4, "%lu overrun",
+               (unsigned long)find_task_by_id(id)->overruns);
+}
+
+// --- Mode drain ---
+static void drain_task(void) {
+    delay_sim_consume_us(100);
+}
+
+static void run_drain(uint32_t budget_us, task_drain_stats_t *stats) {
+    for (int i = 0; i < 4; i++) {
+        task_start_ex(drain_task, 10, TASK_PRIORITY_NORMAL, false);
+    }
+    task_scheduler_set_drain_budget(budget_us * (SystemCoreClock / 1000000));
+    task_reset_drain_stats();
+    run_for_ms(105);
+    task_get_drain_stats(stats);
+    task_scheduler_set_drain_budget(TASK_DRAIN_BUDGET_CYCLES);
+}
+
+static void test_drain_single(void) {
+    task_drain_stats_t stats;
+    run_drain(0, &stats);
+    TEST_CHECK(stats.tasks == 40, "%lu task", (unsigned long)stats.tasks);
+    TEST_CHECK(stats.max_batch == 1, "batch maks %lu", (unsigned long)stats.max_batch);
+    TEST_CHECK(stats.budget_exhausted == 0, "budget habis %lu", (unsigned long)stats.budget_exhausted);
+}
+
+// Budget dicek setelah tiap task: 100, 200, 300 us -> berhenti setelah task ke-3
+static void test_drain_budget(void) {
+    task_drain_stats_t stats;
+    run_drain(250, &stats);
+    TEST_CHECK(stats.tasks == 40, "%lu task", (unsigned long)stats.tasks);
+    TEST_CHECK(stats.max_batch == 3, "batch maks %lu", (unsigned long)stats.max_batch);
+    TEST_CHECK(stats.budget_exhausted == 10, "budget habis %lu", (unsigned long)stats.budget_exhausted);
+    TEST_CHECK(stats.max_cycles >= 250 * (SystemCoreClock / 1000000), "batch terlama %lu siklus",
+               (unsigned long)stats.max_cycles);
+}
+
+static void test_drain_all(void) {
+    task_drain_stats_t stats;
+    run_drain(10000, &stats);
+    TEST_CHECK(stats.tasks == 40, "%lu task", (unsigned long)stats.tasks);
+    TEST_CHECK(stats.max_batch == 4, "batch maks %lu", (unsigned long)stats.max_batch);
+    TEST_CHECK(stats.batches == 10, "%lu batch", (unsigned long)stats.batches);
+    TEST_CHECK(stats.budget_exhausted == 0, "budget habis %lu", (unsigned long)stats.budget_exhausted);
+}
+
+// --- Tickless idle ---
+static uint32_t wake_runs;
+static uint32_t wake_interval;
+static uint32_t wake_first_ms;
+static uint32_t wake_errors;
+static uint32_t irq_wakeups;
+
+// systick_millis harus tetap sama dengan waktu virtual setelah tidur panjang
+static uint8_t millis_in_sync(void) {
+    return systick_millis == (uint32_t)(delay_sim_cycles() / cycles_per_ms());
+}
+
+static void wake_task(void) {
+    uint32_t expected = wake_first_ms + wake_runs * wake_interval;
+    wake_runs++;
+    if (systick_millis != expected || !millis_in_sync()) {
+        wake_errors++;
+    }
+}
+
+static void other_irq(void) {
+    irq_wakeups++;
+}
+
+static void run_tickless(uint32_t interval_ms, uint32_t run_ms, uint32_t irq_period_us) {
+    wake_runs = 0;
+    wake_errors = 0;
+    irq_wakeups = 0;
+    wake_interval = interval_ms;
+    wake_first_ms = systick_millis + interval_ms;
+    if (irq_period_us > 0) {
+        delay_sim_add_periodic_irq(irq_period_us, 0, other_irq);
+    }
+    delay_set_tickless(true);
+    task_start_ex(wake_task, interval_ms, TASK_PRIORITY_NORMAL, false);
+    delay_reset_isr_stats();
+    run_for_ms(run_ms);
+}
+
+static void test_tickless_wake(void) {
+    run_tickless(50, 1005, 0);
+
+    systick_isr_stats_t isr;
+    tickless_stats_t tl;
+    delay_get_isr_stats(&isr);
+    delay_get_tickless_stats(&tl);
+    TEST_CHECK(wake_runs == 20, "%lu eksekusi", (unsigned long)wake_runs);
+    TEST_CHECK(wake_errors == 0, "%lu bangun tidak tepat di deadline", (unsigned long)wake_errors);
+    TEST_CHECK(millis_in_sync(), "millis %lu, waktu virtual %llu ms", (unsigned long)systick_millis,
+               (unsigned long long)(delay_sim_cycles() / cycles_per_ms()));
+    // Satu tick per rilis (plus sisa tick di awal/akhir), bukan 1000
+    TEST_CHECK(isr.ticks <= 25, "%lu tick SysTick", (unsigned long)isr.ticks);
+    TEST_CHECK(tl.sleeps >= 19 && tl.early_wakeups == 0, "%lu tidur, %lu bangun awal",
+               (unsigned long)tl.sleeps, (unsigned long)tl.early_wakeups);
+}
+
+// Interupsi lain membangunkan core di tengah tidur; jadwal dan millis tetap tepat
+static void test_tickless_early_wake(void) {
+    run_tickless(50, 1005, 7300);
+
+    tickless_stats_t tl;
+    delay_get_tickless_stats(&tl);
+    TEST_CHECK(wake_runs == 20, "%lu eksekusi", (unsigned long)wake_runs);
+    TEST_CHECK(wake_errors == 0, "%lu bangun tidak tepat di deadline", (unsigned long)wake_errors);
+    TEST_CHECK(millis_in_sync(), "millis %lu, waktu virtual %llu ms", (unsigned long)systick_millis,
+               (unsigned long long)(delay_sim_cycles() / cycles_per_ms()));
+    TEST_CHECK(irq_wakeups >= 136 && tl.early_wakeups > 0, "%lu IRQ, %lu bangun awal",
+               (unsigned long)irq_wakeups, (unsigned long)tl.early_wakeups);
+}
+
+// Di 108 MHz reload 24-bit hanya ~155 ms: tidur panjang dipecah, jadwal tetap tepat
+static void test_tickless_long_idle(void) {
+    run_tickless(500, 3005, 0);
+
+    tickless_stats_t tl;
+    delay_get_tickless_stats(&tl);
+    TEST_CHECK(wake_runs == 6, "%lu eksekusi", (unsigned long)wake_runs);
+    TEST_CHECK(wake_errors == 0, "%lu bangun tidak tepat di deadline", (unsigned long)wake_errors);
+    TEST_CHECK(millis_in_sync(), "millis %lu, waktu virtual %llu ms", (unsigned long)systick_millis,
+               (unsigned long long)(delay_sim_cycles() / cycles_per_ms()));
+    TEST_CHECK(tl.sleeps >= 6 * 3, "%lu tidur", (unsigned long)tl.sleeps);
+}
+
+static void test_tickless_delay_ms(void) {
+    delay_set_tickless(true);
+    for (uint32_t ms = 1; ms < 200; ms += 37) {
+        uint64_t start = delay_sim_cycles();
+        delay_ms(ms);
+        uint64_t elapsed = delay_sim_cycles() - start;
+        TEST_CHECK(elapsed > (ms - 1) * cycles_per_ms() && elapsed <= ms * cycles_per_ms(),
+                   "delay_ms(%lu) = %llu siklus", (unsigned long)ms, (unsigned long long)elapsed);
+        delay_sim_consume_cycles(test_rand(cycles_per_ms()));
+    }
+    TEST_CHECK(millis_in_sync(), "millis %lu, waktu virtual %llu ms", (unsigned long)systick_millis,
+               (unsigned long long)(delay_sim_cycles() / cycles_per_ms()));
+}
+
+// --- Tabel task statis ---
+#define STATIC_LOG_MAX  256
+
+static uint16_t static_log[STATIC_LOG_MAX];
+static uint32_t static_log_count;
+static uint32_t static_period_errors;
+
+static void static_log_run(uint16_t id, uint32_t period_ms) {
+    if (static_log_count < STATIC_LOG_MAX) {
+        static_log[static_log_count] = id;
+    }
+    static_log_count++;
+    if (task_current_period_ms() != period_ms) {
+        static_period_errors++;
+    }
+}
+
+static void static_fast_task(void) { static_log_run(TASK_STATIC_ID(0), 10); }
+static void static_normal_task(void) { static_log_run(TASK_STATIC_ID(1), 10); }
+static void static_slow_task(void) { static_log_run(TASK_STATIC_ID(2), 20); }
+static void dynamic_high_task(void) { static_log_run(0, 10); }
+
+#define TEST_TASKS(X) \
+    X(fast,   static_fast_task,   10, TASK_PRIORITY_HIGH) \
+    X(normal, static_normal_task, 10, TASK_PRIORITY_NORMAL) \
+    X(slow,   static_slow_task,   20, TASK_PRIORITY_HIGH)
+TASK_TABLE_DEFINE(TEST_TASKS);
+
+static uint32_t static_count_runs(uint16_t id) {
+    uint32_t runs = 0;
+    for (uint32_t i = 0; i < static_log_count && i < STATIC_LOG_MAX; i++) {
+        if (static_log[i] == id) runs++;
+    }
+    return runs;
+}
+
+// Semua rilis di tick yang sama: statis HIGH urut tabel, lalu dinamis HIGH, lalu NORMAL
+static void test_static_table(void) {
+    static const uint16_t order[] = {
+        TASK_STATIC_ID(0), TASK_STATIC_ID(2), 0, TASK_STATIC_ID(1)
+    };
+
+    // Mask prioritas dirakit TASK_TABLE_DEFINE saat compile
+    TEST_CHECK(TEST_TASKS_prio_mask[TASK_PRIORITY_LOW] == 0 && TEST_TASKS_prio_mask[TASK_PRIORITY_NORMAL] == 0x2
+               && TEST_TASKS_prio_mask[TASK_PRIORITY_HIGH] == 0x5 && TEST_TASKS_prio_mask[TASK_PRIORITY_CRITICAL] == 0,
+               "prio_mask %lx/%lx/%lx/%lx", (unsigned long)TEST_TASKS_prio_mask[0],
+               (unsigned long)TEST_TASKS_prio_mask[1], (unsigned long)TEST_TASKS_prio_mask[2],
+               (unsigned long)TEST_TASKS_prio_mask[3]);
+
+    delay_set_tickless(false);      // Bangun setiap tick, run_for_ms berhenti tepat waktu
+    TEST_CHECK(TASK_TABLE_START(TEST_TASKS), "task_table_start gagal");
+    TEST_CHECK(!TASK_TABLE_START(TEST_TASKS), "tabel kedua diterima");
+    uint16_t dyn_id = task_start_ex(dynamic_high_task, 10, TASK_PRIORITY_HIGH, false);
+    TEST_CHECK(dyn_id != INVALID_TASK_ID && dyn_id < TASK_STATIC_ID_BASE, "ID dinamis %u", dyn_id);
+    TEST_CHECK(get_active_task_count() == 4, "%u task aktif", get_active_task_count());
+    TEST_CHECK(!task_stop_by_id(TASK_ID_fast), "task statis bisa di-stop");
+
+    // Stall sebelum tick 20 supaya semua rilis menunggu bersama
+    run_for_ms(15);
+    static_log_count = 0;
+    delay_sim_consume_cycles(6 * cycles_per_ms());
+    run_for_ms(1);
+    TEST_CHECK(static_log_count == 4, "%lu task jalan di tick 20", (unsigned long)static_log_count);
+    for (uint32_t i = 0; i < 4 && i < static_log_count; i++) {
+        TEST_CHECK(static_log[i] == order[i], "urutan ke-%lu: task %u, harus %u",
+                   (unsigned long)i, static_log[i], order[i]);
+    }
+
+    // Jadwal tetap: 10/10/20 ms, tanpa overrun
+    static_log_count = 0;
+    static_period_errors = 0;
+    run_for_ms(204);
+    TEST_CHECK(static_count_runs(TASK_STATIC_ID(0)) == 20, "fast jalan %lu kali",
+               (unsigned long)static_count_runs(TASK_STATIC_ID(0)));
+    TEST_CHECK(static_count_runs(TASK_STATIC_ID(1)) == 20, "normal jalan %lu kali",
+               (unsigned long)static_count_runs(TASK_STATIC_ID(1)));
+    TEST_CHECK(static_count_runs(TASK_STATIC_ID(2)) == 10, "slow jalan %lu kali",
+               (unsigned long)static_count_runs(TASK_STATIC_ID(2)));
+    TEST_CHECK(static_period_errors == 0, "%lu periode salah", (unsigned long)static_period_errors);
+    TEST_CHECK(task_get_missed_activations(TASK_ID_fast) == 0, "fast overrun %lu",
+               (unsigned long)task_get_missed_activations(TASK_ID_fast));
+
+    // Suspend menghentikan rilis; resume mulai periode baru dari saat resume
+    TEST_CHECK(task_suspend_by_id(TASK_ID_normal), "suspend gagal");
+    TEST_CHECK(!task_suspend_by_id(TASK_ID_normal), "suspend dua kali diterima");
+    static_log_count = 0;
+    run_for_ms(100);
+    TEST_CHECK(static_count_runs(TASK_STATIC_ID(1)) == 0, "normal jalan %lu kali saat suspend",
+               (unsigned long)static_count_runs(TASK_STATIC_ID(1)));
+    delay_sim_consume_cycles(3 * cycles_per_ms());
+    uint32_t resume_ms = systick_millis;
+    TEST_CHECK(task_resume_by_callback(static_normal_task), "resume gagal");
+    static_log_count = 0;
+    run_for_ms(9);
+    TEST_CHECK(static_count_runs(TASK_STATIC_ID(1)) == 0, "normal jalan sebelum periode penuh");
+    run_for_ms(2);
+    TEST_CHECK(static_count_runs(TASK_STATIC_ID(1)) == 1, "normal jalan %lu kali setelah resume",
+               (unsigned long)static_count_runs(TASK_STATIC_ID(1)));
+    TEST_CHECK(_static_tasks[1].prev_release_ms == resume_ms + 10, "rilis pertama %lu, resume %lu",
+               (unsigned long)_static_tasks[1].prev_release_ms, (unsigned long)resume_ms);
+
+    // Stall 35 ms: rilis yang jatuh saat task masih antri dihitung overrun
+    run_for_ms(5);
+    delay_sim_consume_cycles(35 * cycles_per_ms());
+    run_for_ms(1);
+    TEST_CHECK(task_get_missed_activations(TASK_ID_fast) == 3, "fast overrun %lu",
+               (unsigned long)task_get_missed_activations(TASK_ID_fast));
+    TEST_CHECK(millis_in_sync(), "millis %lu, waktu virtual %llu ms", (unsigned long)systick_millis,
+               (unsigned long long)(delay_sim_cycles() / cycles_per_ms()));
+}
+
+// --- Lookup ID -> slot ---
+static uint32_t id_map_events;
+
+static void id_map_event_task(void) {
+    id_map_events |= task_current_events();
+}
+
+// ID berputar melewati wrap next_task_id dan banyak kelipatan TASK_ID_MAP_SIZE:
+// task hidup tetap ditemukan lewat bucket-nya, ID yang sudah stop tidak
+static void test_id_map(void) {
+    uint16_t ids[MAX_TASK - 1];
+    uint8_t count = 0;
+    uint16_t last_id = 0;
+    uint8_t wrapped = 0;
+
+    id_map_events = 0;
+    uint16_t event_id = task_start_event(id_map_event_task, 0x1, 0, TASK_PRIORITY_HIGH);
+    TEST_CHECK(event_id != INVALID_TASK_ID, "task event gagal start");
+
+    for (uint32_t round = 0; round < 200000; round++) {
+        if (count == 0 || (count < MAX_TASK - 1 && test_rand(2) != 0)) {
+            uint16_t id = task_start_ex(quick_task, 1 + test_rand(40), TASK_PRIORITY_NORMAL, false);
+            TEST_CHECK(id != INVALID_TASK_ID && id < TASK_STATIC_ID_BASE, "ID dinamis %u", id);
+            wrapped |= (id < last_id);
+            last_id = id;
+            ids[count++] = id;
+        } else {
+            uint8_t i = (uint8_t)test_rand(count);
+            TEST_CHECK(task_stop_by_id(ids[i]), "stop ID %u gagal", ids[i]);
+            TEST_CHECK(find_task_by_id(ids[i]) == NULL, "ID %u ditemukan setelah stop", ids[i]);
+            ids[i] = ids[--count];
+        }
+        for (uint8_t i = 0; i < count; i++) {
+            task_t *task = find_task_by_id(ids[i]);
+            TEST_CHECK(task != NULL && task->task_id == ids[i], "ID %u tidak ditemukan", ids[i]);
+        }
+        TEST_CHECK(find_task_by_id(event_id) != NULL, "task event hilang di putaran %lu",
+                   (unsigned long)round);
+    }
+    TEST_CHECK(wrapped, "next_task_id belum wrap (terakhir %u)", last_id);
+
+    TEST_CHECK(task_post_event(event_id, 0x1), "post_event ke ID %u gagal", event_id);
+    run_for_ms(1);
+    TEST_CHECK(id_map_events == 0x1, "event diterima 0x%lx", (unsigned long)id_map_events);
+}
+
+int main(void) {
+    TEST_RUN(test_heap_order, 1000000);
+    TEST_RUN(test_overrun_skip, 1000000);
+    TEST_RUN(test_overrun_catchup, 1000000);
+    TEST_RUN(test_overrun_coalesce, 1000000);
+    TEST_RUN(test_release_while_queued, 1000000);
+    TEST_RUN(test_drain_single, 1000000);
+    TEST_RUN(test_drain_budget, 1000000);
+    TEST_RUN(test_drain_all, 1000000);
+    TEST_RUN(test_tickless_wake, 1000000);
+    TEST_RUN(test_tickless_early_wake, 1000000);
+    TEST_RUN(test_tickless_long_idle, 108000000);
+    TEST_RUN(test_tickless_delay_ms, 108000000);
+    TEST_RUN(test_static_table, 1000000);
+    TEST_RUN(test_id_map, 1000000);
+    return test_report();
+}